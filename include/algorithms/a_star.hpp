@@ -0,0 +1,121 @@
+#ifndef INCLUDE_ALGORITHMS_A_STAR_HPP
+#define INCLUDE_ALGORITHMS_A_STAR_HPP
+
+#include <type_traits>
+#include <utility>
+
+#include "utils/graph_traits.hpp"
+#include "utils/distance.hpp"
+#include "utils/vertex_queue.hpp"
+#include "single_source_shortest_paths.hpp"
+#include "dijkstra.hpp"
+
+namespace graphs
+{
+
+// A* search of the shortest path from the source to the target. Heuristic h(v) estimates the
+// distance from v to the target; vertices are settled in order of the distance from the source
+// plus the estimate, so with a good heuristic far fewer vertices than in Dijkstra's algorithm are
+// settled before the target. The run stops once the target is settled.
+//
+// The heuristic must be admissible (never overestimate) for the distance to the target to be
+// exact. If it's also consistent, i.e. h(u) <= w(u, v) + h(v) for every edge (u, v), every vertex
+// is settled once and distances to all settled vertices are exact; otherwise, a settled vertex
+// whose distance decreases is queued again, and its key may be less than the last popped one.
+// That's why the default queue is d_ary_heap<4> whatever the weight type is: radix_heap and
+// dial_buckets accept only non-decreasing keys, so they may be chosen only for a consistent
+// heuristic with non-negative values.
+//
+// A zero heuristic turns A* search into Dijkstra's algorithm with a target.
+
+template<typename G, typename Heuristic, typename Traits = graph_traits<G>, // G stands for "graph"
+         typename Queue = d_ary_heap<4>>
+requires std::is_invocable_r_v<typename Traits::weight_type, const Heuristic &,
+                               typename Traits::size_type>
+class A_Star final
+    : public SSSP<G, Traits, Vertex_Queue<Queue, typename Traits::size_type,
+                                         Distance<typename Traits::weight_type>>>
+{
+    using queue_type = Vertex_Queue<Queue, typename Traits::size_type,
+                                    Distance<typename Traits::weight_type>>;
+    using sssp = SSSP<G, Traits, queue_type>;
+    using typename sssp::size_type;
+    using typename sssp::weight_type;
+
+public:
+
+    using typename sssp::distance_type;
+    using typename sssp::workspace_type;
+
+    // Throws Negative_Weights if an edge with negative weight is met
+    A_Star(const G &g, size_type source_i, size_type target_i, Heuristic h)
+        : sssp{g, source_i}, h_{std::move(h)}
+    {
+        this->ws().check_index(target_i);
+        run(g, source_i, target_i);
+    }
+
+    A_Star(const G &g, size_type source_i, size_type target_i, Heuristic h, workspace_type &ws)
+        : sssp{g, source_i, &ws}, h_{std::move(h)}
+    {
+        this->ws().check_index(target_i);
+        run(g, source_i, target_i);
+    }
+
+private:
+
+    distance_type key(size_type i, distance_type d) const
+    {
+        return d + static_cast<weight_type>(h_(i));
+    }
+
+    void run(const G &g, size_type source_i, size_type target_i)
+    {
+        workspace_type &ws = this->ws();
+
+        // Settled vertices are marked. A vertex with finite distance which isn't marked is in the
+        // queue
+
+        queue_type &Q = ws.extra();
+        Q.reset(ws.n_vertices());
+        Q.push(source_i, key(source_i, 0));
+
+        while (!Q.empty())
+        {
+            const auto [u_i, u_key] = Q.pop();
+            const distance_type u_d = ws.distance(u_i);
+            if (ws.marked(u_i) || key(u_i, u_d) < u_key)
+                continue; // a stale entry of a queue with lazy decrease-key
+
+            ws.mark(u_i);
+            if (u_i == target_i)
+                break;
+
+            for (auto [v_i, w] : adjacent_edges<Traits>(g, u_i))
+            {
+                if (w < 0)
+                    throw Negative_Weights{};
+
+                if (distance_type d = u_d + w; d < ws.distance(v_i))
+                {
+                    const bool queued = !ws.distance(v_i).is_inf() && !ws.marked(v_i);
+                    ws.set_distance(v_i, d, u_i);
+
+                    if (queued)
+                        Q.decrease(v_i, key(v_i, d));
+                    else
+                    {
+                        ws.unmark(v_i); // reopening a settled vertex for inconsistent heuristics
+                        Q.push(v_i, key(v_i, d));
+                    }
+                }
+            }
+        }
+    }
+
+    Heuristic h_;
+};
+
+} // namespace graphs
+
+#endif // INCLUDE_ALGORITHMS_A_STAR_HPP
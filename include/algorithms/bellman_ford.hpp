@@ -1,70 +1,395 @@
 #ifndef INCLUDE_ALGORITHMS_BELLMAN_FORD_HPP
 #define INCLUDE_ALGORITHMS_BELLMAN_FORD_HPP
 
+#include <span>
+#include <deque>
+#include <vector>
 #include <ranges>
+#include <algorithm>
+#include <bit>
+#include <array>
+#include <atomic>
+#include <barrier>
+#include <cstddef>
+#include <concepts>
+#include <type_traits>
 
 #include "utils/graph_traits.hpp"
+#include "utils/radix_sort.hpp"
 #include "single_source_shortest_paths.hpp"
 
 namespace graphs
 {
 
-template<typename G, typename Traits = graph_traits<G>> // G stands for "graph"
+// a tag to be used if you want to run Bellman-Ford algorithm from a virtual vertex connected to
+// every vertex of the graph with zero-weight edges
+struct virtual_source final {};
+
+// Modes of Bellman-Ford algorithm:
+// - rounds: every round relaxes all edges, and the run stops after the first round which changes
+//   nothing
+// - fifo_queue: a FIFO queue of vertices whose distances have decreased since they were last
+//   scanned (also known as SPFA), so only edges of these vertices are relaxed again
+// - slf_queue: fifo_queue with the "smallest label first" rule: a vertex is pushed to the front of
+//   the queue rather than to the back if its distance is less than the one of the front vertex
+// - parallel_rounds: rounds on n_threads threads (0 stands for all hardware threads). Edges are
+//   copied to arrays of sources and weights grouped by destinations, and every thread computes
+//   new distances of a range of destinations from the distances of the previous round (Jacobi
+//   iteration with two buffers of distances), so threads don't write shared data. The minimum over
+//   the incoming edges of a vertex is a plain reduction over contiguous arrays which compilers can
+//   vectorize; the predecessor is looked for only if the distance decreases. A round may need the
+//   results of the previous one where a sequential round would use the ones of the same round, so
+//   more rounds are made, but every round costs O((V + E) / n_threads)
+// All modes are O(V * E) in the worst case, but on typical graphs the queues stop after a few
+// scans of every vertex. Negative weight cycles are found as cycles of predecessors, which every
+// negative weight cycle reachable from the source sooner or later makes: the queues search the
+// predecessor graph for a cycle every V relaxations, which is O(1) per relaxation, and the rounds
+// do it after rounds 1, 2, 4, 8 and so on.
+struct rounds final {};
+struct fifo_queue final {};
+struct slf_queue final {};
+
+struct parallel_rounds final
+{
+    unsigned n_threads = 0;
+};
+
+template<typename Mode>
+concept bellman_ford_mode = std::same_as<Mode, rounds> || std::same_as<Mode, fifo_queue> ||
+                            std::same_as<Mode, slf_queue> || std::same_as<Mode, parallel_rounds>;
+
+template<typename G, typename Traits = graph_traits<G>, // G stands for "graph"
+         bellman_ford_mode Mode = fifo_queue>
 class Bellman_Ford final : public SSSP<G, Traits>
 {
     using sssp = SSSP<G, Traits>;
-    using sssp::info_;
     using typename sssp::size_type;
-    using typename sssp::Info_Node;
+    using typename sssp::weight_type;
 
 public:
 
     using typename sssp::distance_type;
+    using typename sssp::workspace_type;
+    using mode = Mode;
+
+    Bellman_Ford(const G &g, size_type source_i, Mode mode = {}) : sssp{g, source_i}
+    {
+        run(g, mode);
+    }
+
+    Bellman_Ford(const G &g, size_type source_i, workspace_type &ws, Mode mode = {})
+        : sssp{g, source_i, &ws}
+    {
+        run(g, mode);
+    }
+
+    // Distances computed this way are the potentials used by Johnson's algorithm
+    Bellman_Ford(const G &g, virtual_source, Mode mode = {}) : sssp{g} { run(g, mode); }
+
+    Bellman_Ford(const G &g, virtual_source, workspace_type &ws, Mode mode = {})
+        : sssp{g, &ws}
+    {
+        run(g, mode);
+    }
+
+    // If there are negative weight cycles, no distances are kept
+    bool has_negative_weight_cycles() const noexcept { return !cycle_.empty(); }
+
+    explicit operator bool() const noexcept { return !has_negative_weight_cycles(); }
 
-    Bellman_Ford(const G &g, size_type source_i) : sssp{g, source_i}
+    // Vertices of a negative weight cycle reachable from the source in the order of its edges
+    // (the last vertex is connected to the first one) or nothing if there are no such cycles
+    std::span<const size_type> negative_cycle() const noexcept { return cycle_; }
+
+private:
+
+    void run(const G &g, Mode mode)
     {
         const size_type n_vertices = Traits::n_vertices(g);
+        if (n_vertices == 0)
+            return;
 
-        for (auto _ : std::views::iota(size_type{0}, n_vertices - 1))
+        if constexpr (std::is_same_v<Mode, rounds>)
+            run_rounds(g, n_vertices);
+        else if constexpr (std::is_same_v<Mode, parallel_rounds>)
+            run_parallel_rounds(g, n_vertices, mode.n_threads);
+        else
+            run_queue(g, n_vertices);
+
+        if (has_negative_weight_cycles())
+            this->ws().reset(0);
+    }
+
+    void run_rounds(const G &g, size_type n_vertices)
+    {
+        workspace_type &ws = this->ws();
+
+        for (size_type round = 1; ; ++round)
         {
+            bool changed = false;
+
             for (auto u_i : std::views::iota(size_type{0}, n_vertices))
             {
-                const Info_Node &u_info = info_.find(u_i)->second;
+                const distance_type u_d = ws.distance(u_i);
+                if (u_d.is_inf())
+                    continue;
 
-                for (auto v_i : Traits::adjacent_vertices(g, u_i))
+                for (auto [v_i, w] : adjacent_edges<Traits>(g, u_i))
                 {
-                    Info_Node &v_info = info_.find(v_i)->second;
-
-                    if (distance_type d = u_info.distance + Traits::weight(g, u_i, v_i);
-                        d < v_info.distance)
+                    if (distance_type d = u_d + w; d < ws.distance(v_i))
                     {
-                        v_info.distance = d;
-                        v_info.predecessor = u_i;
+                        ws.set_distance(v_i, d, u_i);
+                        changed = true;
                     }
                 }
             }
+
+            if (!changed)
+                return;
+
+            if (std::has_single_bit(round) && find_predecessor_cycle())
+                return;
+        }
+    }
+
+    void run_queue(const G &g, size_type n_vertices)
+    {
+        workspace_type &ws = this->ws();
+
+        // Vertices in the queue are marked
+
+        std::deque<size_type> queue;
+        for (auto i : ws.touched())
+        {
+            queue.push_back(i);
+            ws.mark(i);
+        }
+
+        size_type n_relaxations = 0;
+
+        while (!queue.empty())
+        {
+            const size_type u_i = queue.front();
+            queue.pop_front();
+            ws.unmark(u_i);
+
+            const distance_type u_d = ws.distance(u_i);
+
+            for (auto [v_i, w] : adjacent_edges<Traits>(g, u_i))
+            {
+                distance_type d = u_d + w;
+                if (!(d < ws.distance(v_i)))
+                    continue;
+
+                ws.set_distance(v_i, d, u_i);
+
+                if (!ws.marked(v_i))
+                {
+                    ws.mark(v_i);
+
+                    if (std::is_same_v<Mode, slf_queue> && !queue.empty() &&
+                        d < ws.distance(queue.front()))
+                        queue.push_front(v_i);
+                    else
+                        queue.push_back(v_i);
+                }
+
+                if (++n_relaxations == n_vertices)
+                {
+                    n_relaxations = 0;
+                    if (find_predecessor_cycle())
+                        return;
+                }
+            }
         }
+    }
+
+    void run_parallel_rounds(const G &g, size_type n_vertices, unsigned n_threads)
+    {
+        workspace_type &ws = this->ws();
+
+        // Incoming edges of vertex v are sources[e] and weights[e] for e in
+        // [offsets[v], offsets[v + 1])
 
+        std::vector<size_type> offsets(n_vertices + 1, 0);
         for (auto u_i : std::views::iota(size_type{0}, n_vertices))
         {
-            const Info_Node &u_info = info_.find(u_i)->second;
+            for (auto [v_i, w] : adjacent_edges<Traits>(g, u_i))
+                ++offsets[v_i + 1];
+        }
+
+        for (auto v_i : std::views::iota(size_type{0}, n_vertices))
+            offsets[v_i + 1] += offsets[v_i];
+
+        const size_type n_edges = offsets.back();
+        std::vector<size_type> sources(n_edges);
+        std::vector<weight_type> weights(n_edges);
 
-            for (auto v_i : Traits::adjacent_vertices(g, u_i))
+        {
+            std::vector<size_type> next(offsets.begin(), offsets.end() - 1);
+            for (auto u_i : std::views::iota(size_type{0}, n_vertices))
             {
-                const Info_Node &v_info = info_.find(v_i)->second;
+                for (auto [v_i, w] : adjacent_edges<Traits>(g, u_i))
+                {
+                    sources[next[v_i]] = u_i;
+                    weights[next[v_i]++] = w;
+                }
+            }
+        }
+
+        // Threads get ranges of destinations with about equal numbers of vertices plus edges
+
+        n_threads = choose_n_threads(n_vertices + n_edges, n_threads);
+
+        std::vector<size_type> bounds(n_threads + 1, n_vertices);
+        for (auto t : std::views::iota(0u, n_threads))
+        {
+            const size_type work = (n_vertices + n_edges) / n_threads * t;
+            auto less = [&offsets](size_type v_i, size_type work)
+            {
+                return v_i + offsets[v_i] < work;
+            };
+
+            bounds[t] = *std::ranges::lower_bound(std::views::iota(size_type{0}, n_vertices),
+                                                  work, less);
+        }
+
+        std::array<std::vector<distance_type>, 2> buffers;
+        buffers[0].assign(ws.distances().begin(), ws.distances().end());
+        buffers[1].resize(n_vertices);
+        std::vector<size_type> predecessors(ws.predecessors().begin(), ws.predecessors().end());
+
+        // Rounds are made in phases between searches of the predecessor graph for a cycle
 
-                if (v_info.distance > u_info.distance + Traits::weight(g, u_i, v_i))
+        std::size_t current = 0; // buffers[current] holds the distances of the last round
+        size_type round = 0;
+        size_type phase_end = 1;
+        bool last_changed = true;
+        std::atomic<bool> changed = false;
+
+        // runs when all threads have finished a round and before any of them starts the next one
+        auto on_round_end = [&]() noexcept
+        {
+            last_changed = changed.exchange(false, std::memory_order_relaxed);
+            current ^= 1;
+            ++round;
+        };
+
+        std::barrier sync{static_cast<std::ptrdiff_t>(n_threads), on_round_end};
+
+        while (true)
+        {
+            parallel_for(n_threads, [&](unsigned t)
+            {
+                do
                 {
-                    info_.clear();
-                    return;
+                    const bool decreased = relax(bounds[t], bounds[t + 1], offsets, sources,
+                                                 weights, buffers[current], buffers[current ^ 1],
+                                                 predecessors);
+                    if (decreased)
+                        changed.store(true, std::memory_order_relaxed);
+
+                    sync.arrive_and_wait();
                 }
+                while (last_changed && round != phase_end);
+            });
+
+            const bool converged = !last_changed;
+
+            for (auto v_i : std::views::iota(size_type{0}, n_vertices))
+            {
+                if (const distance_type d = buffers[current][v_i]; !d.is_inf())
+                    ws.set_distance(v_i, d, predecessors[v_i]);
             }
+
+            if (converged || find_predecessor_cycle())
+                return;
+
+            phase_end = 2 * round;
         }
     }
 
-    bool has_negative_weight_cycles() const noexcept { return info_.empty(); }
+    // Computes the distances of vertices with indices in [first, last) after one more round from
+    // the distances of the previous round (from) and stores them in to. Returns whether any of
+    // them has decreased
+    static bool relax(size_type first, size_type last, const std::vector<size_type> &offsets,
+                      const std::vector<size_type> &sources,
+                      const std::vector<weight_type> &weights,
+                      const std::vector<distance_type> &from, std::vector<distance_type> &to,
+                      std::vector<size_type> &predecessors)
+    {
+        bool decreased = false;
 
-    explicit operator bool() const noexcept { return !has_negative_weight_cycles(); }
+        for (auto v_i : std::views::iota(first, last))
+        {
+            const size_type edges_begin = offsets[v_i], edges_end = offsets[v_i + 1];
+
+            distance_type min = from[v_i];
+            for (auto e : std::views::iota(edges_begin, edges_end))
+            {
+                const distance_type d = from[sources[e]] + weights[e];
+                min = d < min ? d : min;
+            }
+
+            to[v_i] = min;
+
+            if (min < from[v_i])
+            {
+                decreased = true;
+
+                auto e = edges_begin;
+                while (!(from[sources[e]] + weights[e] == min))
+                    ++e;
+
+                predecessors[v_i] = sources[e];
+            }
+        }
+
+        return decreased;
+    }
+
+    // Every cycle of predecessors has negative weight. If there is one, it's stored in cycle_.
+    // O(touched)
+    bool find_predecessor_cycle()
+    {
+        const workspace_type &ws = this->ws();
+        const std::span<const size_type> touched = ws.touched();
+
+        // walk[i] is the number of the walk along predecessors which has visited vertex i plus 1
+        std::vector<size_type> &walk = walks_;
+        walk.resize(ws.n_vertices());
+
+        for (auto n : std::views::iota(size_type{0}, static_cast<size_type>(touched.size())))
+        {
+            const size_type walk_n = n + 1;
+
+            auto i = touched[n];
+            while (i != sssp::nil && walk[i] == 0)
+            {
+                walk[i] = walk_n;
+                i = ws.predecessor(i);
+            }
+
+            if (i != sssp::nil && walk[i] == walk_n)
+            {
+                // i is on a cycle which is traversed backwards along predecessors
+                cycle_.push_back(i);
+                for (auto j = ws.predecessor(i); j != i; j = ws.predecessor(j))
+                    cycle_.push_back(j);
+
+                std::ranges::reverse(cycle_);
+                return true;
+            }
+        }
+
+        for (auto i : touched)
+            walk[i] = 0;
+
+        return false;
+    }
+
+    std::vector<size_type> cycle_;
+    std::vector<size_type> walks_; // kept zeroed between searches
 };
 
 } // namespace graphs
@@ -2,127 +2,95 @@
 #define INCLUDE_ALGORITHMS_BFS_HPP
 
 #include <cstddef>
-#include <optional>
-#include <unordered_map>
-#include <queue>
+#include <span>
 #include <vector>
-#include <algorithm>
-#include <ranges>
 
 #include "utils/graph_traits.hpp"
 #include "utils/distance.hpp"
+#include "utils/workspace.hpp"
 
 namespace graphs
 {
 
+// Results are stored either in a workspace owned by the object or in a workspace passed by the
+// user. In the latter case they are valid until the workspace is reset by another run.
 template<typename G, typename Traits = graph_traits<G>> // G stands for "graph"
 class BFS final
 {
 public:
 
-    using distance_type = Distance<std::size_t>;
-
-private:
-
     using size_type = typename Traits::size_type;
+    using distance_type = Distance<std::size_t>;
+    using workspace_type = Workspace<distance_type, size_type>;
 
-    enum class Color { white, gray };
+    // the predecessor of the source and of unreachable vertices
+    static constexpr size_type nil = workspace_type::nil;
 
-    struct Info_Node final
-    {
-        distance_type distance;
-        std::optional<size_type> predecessor;
+    BFS(const G &g, size_type source_i) { run(g, source_i); }
 
-        Info_Node() = default;
-        Info_Node(std::size_t dist) : distance{dist} {}
-    };
+    BFS(const G &g, size_type source_i, workspace_type &ws) : borrowed_{&ws} { run(g, source_i); }
 
-    using color_table_type = std::unordered_map<size_type, Color>;
+    const workspace_type &workspace() const noexcept { return borrowed_ ? *borrowed_ : own_; }
 
-public:
-
-    BFS(const G &g, size_type source_i)
+    distance_type distance(size_type u_i) const
     {
-        auto color_table = bfs_init(g, source_i);
-
-        std::queue<size_type> Q;
-        Q.push(source_i);
-
-        while (!Q.empty())
-        {
-            const size_type u_i = Q.front();
-            Q.pop();
-
-            const Info_Node &u_info = info_.find(u_i)->second;
-
-            for (auto v_i : Traits::adjacent_vertices(g, u_i))
-            {
-                if (color_table[v_i] == Color::white)
-                {
-                    color_table[v_i] = Color::gray;
-
-                    Info_Node &v_info = info_.find(v_i)->second;
-                    v_info.distance = u_info.distance + 1uz;
-                    v_info.predecessor = u_i;
-
-                    Q.push(v_i);
-                }
-            }
-        }
+        workspace().check_index(u_i);
+        return workspace().distance(u_i);
     }
 
-    distance_type distance(size_type u_i) const { return info_.at(u_i).distance; }
-
-    std::vector<size_type> path_to(size_type u_i) const
+    size_type predecessor(size_type u_i) const
     {
-        distance_type u_d = distance(u_i);
-        if (u_d.is_inf())
-            return {};
-
-        std::vector path{u_i};
-
-        for (auto predecessor = info_.find(u_i)->second.predecessor; predecessor.has_value();)
-        {
-            u_i = *predecessor;
-            predecessor = info_.find(u_i)->second.predecessor;
-
-            path.push_back(u_i);
-        }
-
-        std::ranges::reverse(path);
+        workspace().check_index(u_i);
+        return workspace().predecessor(u_i);
+    }
 
-        return path;
+    // distances and predecessors of all vertices indexed by vertex indices
+    std::span<const distance_type> distances() const noexcept { return workspace().distances(); }
+    std::span<const size_type> predecessors() const noexcept
+    {
+        return workspace().predecessors();
     }
 
+    std::vector<size_type> path_to(size_type u_i) const { return workspace().path_to(u_i); }
+
 private:
 
-    color_table_type bfs_init(const G &g, size_type source_i)
-    {
-        color_table_type color_table;
+    // the workspace a run stores results in
+    workspace_type &ws() noexcept { return borrowed_ ? *borrowed_ : own_; }
 
-        const size_type n_vertices = Traits::n_vertices(g);
-        info_.reserve(n_vertices);
-        color_table.reserve(n_vertices);
+    // O(V' + E') where V' and E' are the numbers of reachable vertices and edges if the workspace
+    // was used for a graph with as many vertices before
+    void run(const G &g, size_type source_i)
+    {
+        workspace_type &ws = this->ws();
 
-        for (auto i : std::views::iota(size_type{0}, source_i))
-        {
-            info_.try_emplace(i);
-            color_table.try_emplace(i, Color::white);
-        }
+        ws.reset(Traits::n_vertices(g));
+        ws.check_index(source_i);
 
-        info_.try_emplace(source_i, 0);
-        color_table.try_emplace(source_i, Color::gray);
+        // a vertex is marked (gray) once it's discovered
+        ws.mark(source_i);
+        ws.set_distance(source_i, 0uz);
 
-        for (auto i : std::views::iota(source_i + 1, n_vertices))
+        // Vertices are touched in the order they are discovered, so the list of touched vertices
+        // serves as the queue: the vertices preceding the head have been processed
+        for (size_type head = 0; head < ws.touched().size(); ++head)
         {
-            info_.try_emplace(i);
-            color_table.try_emplace(i, Color::white);
-        }
+            const size_type u_i = ws.touched()[head];
+            const distance_type v_d = ws.distance(u_i) + 1uz;
 
-        return color_table;
+            for (auto v_i : Traits::adjacent_vertices(g, u_i))
+            {
+                if (!ws.marked(v_i))
+                {
+                    ws.mark(v_i);
+                    ws.set_distance(v_i, v_d, u_i);
+                }
+            }
+        }
     }
 
-    std::unordered_map<size_type, Info_Node> info_;
+    workspace_type own_;
+    workspace_type *borrowed_ = nullptr;
 };
 
 } // namespace graphs
@@ -0,0 +1,193 @@
+#ifndef INCLUDE_ALGORITHMS_BIDIRECTIONAL_DIJKSTRA_HPP
+#define INCLUDE_ALGORITHMS_BIDIRECTIONAL_DIJKSTRA_HPP
+
+#include <vector>
+
+#include "utils/graph_traits.hpp"
+#include "utils/transposed_traits.hpp"
+#include "utils/distance.hpp"
+#include "utils/workspace.hpp"
+#include "utils/vertex_queue.hpp"
+#include "dijkstra.hpp"
+
+namespace graphs
+{
+
+// Shortest path between two vertices. Dijkstra's algorithm is run from the source forwards and
+// from the target backwards (along incoming edges), and every step is made by the search with
+// the smaller radius, i.e. the distance of the last settled vertex. Both searches stop when the
+// sum of their radii reaches the length of the shortest path seen so far, so only the vertices
+// nearer to the source or to the target than about half of the distance are settled.
+//
+// Results are stored either in workspaces owned by the object or in workspaces passed by the user.
+// In the latter case they are valid until the workspaces are reset by another run.
+//
+// The graph must provide incoming_vertices().
+
+template<typename G, typename Traits = graph_traits<G>, // G stands for "graph"
+         typename Queue = default_queue<typename Traits::weight_type>>
+requires has_incoming_vertices<Traits, G>
+class Bidirectional_Dijkstra final
+{
+public:
+
+    using size_type = typename Traits::size_type;
+    using weight_type = typename Traits::weight_type;
+    using distance_type = Distance<weight_type>;
+
+private:
+
+    using queue_type = Vertex_Queue<Queue, size_type, distance_type>;
+    using backward_traits = transposed_traits<G, Traits>;
+
+public:
+
+    using workspace_type = Workspace<distance_type, size_type, queue_type>;
+
+    static constexpr size_type nil = workspace_type::nil;
+
+    // Throws Negative_Weights if a settled vertex has an edge with negative weight
+    Bidirectional_Dijkstra(const G &g, size_type source_i, size_type target_i)
+    {
+        run(g, source_i, target_i);
+    }
+
+    Bidirectional_Dijkstra(const G &g, size_type source_i, size_type target_i,
+                           workspace_type &forward_ws, workspace_type &backward_ws)
+        : borrowed_forward_{&forward_ws}, borrowed_backward_{&backward_ws}
+    {
+        run(g, source_i, target_i);
+    }
+
+    // the search from the source
+    const workspace_type &forward_workspace() const noexcept
+    {
+        return borrowed_forward_ ? *borrowed_forward_ : own_forward_;
+    }
+
+    // the search from the target: distances are distances to the target, and predecessors are
+    // the next vertices on the paths to the target
+    const workspace_type &backward_workspace() const noexcept
+    {
+        return borrowed_backward_ ? *borrowed_backward_ : own_backward_;
+    }
+
+    distance_type distance() const noexcept { return distance_; }
+
+    // the shortest path from the source to the target or an empty path if there is no path
+    std::vector<size_type> path() const
+    {
+        if (distance_.is_inf())
+            return {};
+
+        std::vector path = forward_workspace().path_to(meeting_i_);
+
+        const workspace_type &backward = backward_workspace();
+        for (auto i = backward.predecessor(meeting_i_); i != nil; i = backward.predecessor(i))
+            path.push_back(i);
+
+        return path;
+    }
+
+private:
+
+    workspace_type &forward() noexcept
+    {
+        return borrowed_forward_ ? *borrowed_forward_ : own_forward_;
+    }
+
+    workspace_type &backward() noexcept
+    {
+        return borrowed_backward_ ? *borrowed_backward_ : own_backward_;
+    }
+
+    void run(const G &g, size_type source_i, size_type target_i)
+    {
+        workspace_type &forward_ws = forward();
+        workspace_type &backward_ws = backward();
+
+        const size_type n_vertices = Traits::n_vertices(g);
+        forward_ws.reset(n_vertices);
+        backward_ws.reset(n_vertices);
+
+        forward_ws.check_index(source_i);
+        backward_ws.check_index(target_i);
+
+        forward_ws.set_distance(source_i, 0);
+        backward_ws.set_distance(target_i, 0);
+
+        forward_ws.extra().reset(n_vertices);
+        backward_ws.extra().reset(n_vertices);
+
+        forward_ws.extra().push(source_i, 0);
+        backward_ws.extra().push(target_i, 0);
+
+        if (source_i == target_i)
+        {
+            distance_ = 0;
+            meeting_i_ = source_i;
+            return;
+        }
+
+        // If one of the searches runs out of vertices, all paths it could find have been seen
+
+        distance_type forward_radius = 0;
+        distance_type backward_radius = 0;
+
+        while (!forward_ws.extra().empty() && !backward_ws.extra().empty() &&
+               forward_radius + backward_radius < distance_)
+        {
+            if (forward_radius <= backward_radius)
+                step<Traits>(g, forward_ws, backward_ws, forward_radius);
+            else
+                step<backward_traits>(g, backward_ws, forward_ws, backward_radius);
+        }
+    }
+
+    // settles one vertex of the search which uses ws; other is the workspace of the opposite one
+    template<typename Direction>
+    void step(const G &g, workspace_type &ws, const workspace_type &other, distance_type &radius)
+    {
+        const auto [u_i, u_d] = ws.extra().pop();
+        if (ws.distance(u_i) < u_d)
+            return; // a stale entry of a queue with lazy decrease-key
+
+        radius = u_d;
+
+        for (auto [v_i, w] : adjacent_edges<Direction>(g, u_i))
+        {
+            if (w < 0)
+                throw Negative_Weights{};
+
+            if (distance_type d = u_d + w; d < ws.distance(v_i))
+            {
+                const bool queued = !ws.distance(v_i).is_inf();
+                ws.set_distance(v_i, d, u_i);
+
+                if (queued)
+                    ws.extra().decrease(v_i, d);
+                else
+                    ws.extra().push(v_i, d);
+
+                // a path through v_i
+                if (distance_type path_d = d + other.distance(v_i); path_d < distance_)
+                {
+                    distance_ = path_d;
+                    meeting_i_ = v_i;
+                }
+            }
+        }
+    }
+
+    workspace_type own_forward_;
+    workspace_type own_backward_;
+    workspace_type *borrowed_forward_ = nullptr;
+    workspace_type *borrowed_backward_ = nullptr;
+
+    distance_type distance_;
+    size_type meeting_i_ = nil;
+};
+
+} // namespace graphs
+
+#endif // INCLUDE_ALGORITHMS_BIDIRECTIONAL_DIJKSTRA_HPP
@@ -0,0 +1,421 @@
+#ifndef INCLUDE_ALGORITHMS_DELTA_STEPPING_HPP
+#define INCLUDE_ALGORITHMS_DELTA_STEPPING_HPP
+
+#include <cstddef>
+#include <vector>
+#include <ranges>
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <limits>
+#include <utility>
+#include <functional>
+#include <bit>
+#include <stdexcept>
+#include <concepts>
+
+#include "utils/graph_traits.hpp"
+#include "utils/radix_sort.hpp"
+#include "single_source_shortest_paths.hpp"
+#include "dijkstra.hpp"
+
+namespace graphs
+{
+
+// Per-vertex flags and state of threads of Delta_Stepping which it keeps in the extra object of its
+// workspace. All flags are clear and all buckets and lists are empty between runs
+template<typename I, typename D> // I stands for "index", D stands for "distance"
+struct Delta_Stepping_State final
+{
+    struct Request final
+    {
+        I vertex;
+        D distance;
+        I predecessor;
+    };
+
+    // state of a thread
+    struct Local final
+    {
+        // Bucket b is buckets[b % buckets.size()]: the buckets in use are never further than the
+        // heaviest edge from the current one, so they fit in a cyclic array of a power of 2 size
+        std::vector<std::vector<I>> buckets;
+        std::vector<I> scanned; // the bucket being processed
+
+        std::vector<std::size_t> pending; // min-heap of non-empty buckets after the current one
+        std::size_t next = 0;             // the first non-empty bucket after the current one
+
+        std::vector<I> settled; // vertices which have left the current bucket
+
+        // improved vertices and their distances before the first improvement in the current step
+        std::vector<std::pair<I, D>> dirty;
+
+        std::vector<I> touched; // vertices whose distances were infinite before the run
+
+        std::vector<std::vector<Request>> outbox; // requests to every thread
+    };
+
+    // Every vertex is written only by its owner, so flags are bytes rather than bits
+    std::vector<unsigned char> queued;  // the vertex is in a bucket and hasn't been scanned since
+    std::vector<unsigned char> settled; // the vertex is in the settled list of its owner
+    std::vector<unsigned char> dirty;   // the vertex is in the dirty list of its owner
+
+    std::vector<Local> locals;
+};
+
+// Delta-stepping (Meyer and Sanders): a parallel version of Dijkstra's algorithm for graphs with
+// non-negative weights. Vertices are kept in buckets of width delta by their distances, and all
+// vertices of the first non-empty bucket are processed at once: edges not heavier than delta
+// (light ones) are relaxed until the bucket stays empty since they may put vertices back to it,
+// and then heavier edges of the vertices which have left the bucket are relaxed once. Small delta
+// makes the algorithm close to Dijkstra's one with little parallelism; large delta makes it close
+// to Bellman-Ford algorithm with many extra relaxations.
+//
+// The work is done by n_threads threads (0 stands for all hardware threads, and graphs with few
+// vertices get fewer threads). Vertex v is owned by thread v % n_threads, which keeps the buckets
+// of its vertices, scans their edges and is the only thread to update their distances: relaxations
+// of edges to vertices of other threads are sent to them as requests, which are applied after all
+// threads have scanned their vertices. Every thread keeps O(W / delta) buckets in a cyclic array
+// where W is the largest weight, and finding the next non-empty bucket costs O(log(W / delta)).
+//
+// Distances are written to the workspace directly, and per-vertex flags and buckets of threads
+// are kept in its extra object (Delta_Stepping_State), so a run with a workspace reused on the
+// same graph costs O(touched) plus the cost of the search rather than O(V).
+template<typename G, typename Traits = graph_traits<G>> // G stands for "graph"
+class Delta_Stepping final
+    : public SSSP<G, Traits, Delta_Stepping_State<typename Traits::size_type,
+                                                  Distance<typename Traits::weight_type>>>
+{
+    using state_type = Delta_Stepping_State<typename Traits::size_type,
+                                            Distance<typename Traits::weight_type>>;
+    using sssp = SSSP<G, Traits, state_type>;
+    using typename sssp::size_type;
+    using typename sssp::weight_type;
+
+public:
+
+    using typename sssp::distance_type;
+    using typename sssp::workspace_type;
+
+    // Throws std::invalid_argument if delta isn't positive and Negative_Weights if an edge with
+    // negative weight is reachable from the source
+    Delta_Stepping(const G &g, size_type source_i, weight_type delta, unsigned n_threads = 0)
+        : sssp{g, source_i}
+    {
+        run(g, source_i, delta, n_threads);
+    }
+
+    Delta_Stepping(const G &g, size_type source_i, workspace_type &ws, weight_type delta,
+                   unsigned n_threads = 0)
+        : sssp{g, source_i, &ws}
+    {
+        run(g, source_i, delta, n_threads);
+    }
+
+private:
+
+    static constexpr std::size_t no_bucket = std::numeric_limits<std::size_t>::max();
+
+    using Request = typename state_type::Request;
+    using Local = typename state_type::Local;
+
+    void run(const G &g, size_type source_i, weight_type delta, unsigned n_threads)
+    {
+        if (!(delta > 0))
+            throw std::invalid_argument{"delta must be positive"};
+
+        delta_ = delta;
+        ws_ = &this->ws();
+        state_type &state = ws_->extra();
+
+        const size_type n_vertices = Traits::n_vertices(g);
+        n_threads_ = choose_n_threads(n_vertices, n_threads, 1 << 12);
+
+        if (state.queued.size() != n_vertices)
+        {
+            state.queued.assign(n_vertices, false);
+            state.settled.assign(n_vertices, false);
+            state.dirty.assign(n_vertices, false);
+        }
+
+        state.locals.resize(n_threads_);
+        for (auto &local : state.locals)
+            local.outbox.resize(n_threads_);
+
+        current_ = 0;
+        insert(state.locals[owner(source_i)], source_i);
+
+        run_threads(g);
+
+        for (auto &local : state.locals)
+        {
+            for (auto v_i : local.touched)
+                ws_->touch(v_i);
+            local.touched.clear();
+        }
+
+        if (negative_weights_)
+        {
+            discard();
+            throw Negative_Weights{};
+        }
+    }
+
+    // restores the state between runs after a run has been stopped midway
+    void discard()
+    {
+        state_type &state = ws_->extra();
+
+        for (auto v_i : ws_->touched())
+        {
+            state.queued[v_i] = false;
+            state.settled[v_i] = false;
+            state.dirty[v_i] = false;
+        }
+
+        for (auto &local : state.locals)
+        {
+            for (auto &bucket : local.buckets)
+                bucket.clear();
+            local.pending.clear();
+            local.settled.clear();
+            local.dirty.clear();
+            for (auto &outbox : local.outbox)
+                outbox.clear();
+        }
+    }
+
+    void run_threads(const G &g)
+    {
+        auto &locals = ws_->extra().locals;
+
+        std::atomic<bool> current_refilled = false;
+        std::atomic<bool> negative_weights = false;
+        bool light_again = false;
+        bool stop = false;
+
+        std::barrier requests_sent{static_cast<std::ptrdiff_t>(n_threads_)};
+
+        std::barrier light_done{static_cast<std::ptrdiff_t>(n_threads_), [&]() noexcept
+        {
+            light_again = current_refilled.exchange(false, std::memory_order_relaxed);
+            stop = negative_weights.load(std::memory_order_relaxed);
+        }};
+
+        std::barrier bucket_done{static_cast<std::ptrdiff_t>(n_threads_), [&]() noexcept
+        {
+            current_ = std::ranges::min(locals | std::views::transform(&Local::next));
+            stop = current_ == no_bucket;
+        }};
+
+        parallel_for(n_threads_, [&](unsigned t)
+        {
+            Local &local = locals[t];
+
+            while (true)
+            {
+                do
+                {
+                    if (scan_light(g, local))
+                        negative_weights.store(true, std::memory_order_relaxed);
+
+                    requests_sent.arrive_and_wait();
+
+                    if (apply(t))
+                        current_refilled.store(true, std::memory_order_relaxed);
+
+                    light_done.arrive_and_wait();
+                }
+                while (light_again && !stop);
+
+                if (stop)
+                    break;
+
+                scan_heavy(g, local);
+                requests_sent.arrive_and_wait();
+
+                apply(t);
+                local.next = next_bucket(local);
+                bucket_done.arrive_and_wait();
+
+                if (stop)
+                    break;
+            }
+        });
+
+        negative_weights_ = negative_weights.load();
+    }
+
+    unsigned owner(size_type v_i) const noexcept { return static_cast<unsigned>(v_i % n_threads_); }
+
+    std::size_t bucket(distance_type d) const noexcept
+    {
+        return static_cast<std::size_t>(*d / delta_);
+    }
+
+    // b must not be less than the current bucket
+    void insert(Local &local, size_type v_i)
+    {
+        const std::size_t b = bucket(ws_->distance(v_i));
+        if (const std::size_t span = b - current_; span >= local.buckets.size())
+            grow(local, span + 1);
+
+        auto &slot = local.buckets[index(local, b)];
+        if (slot.empty() && b != current_)
+        {
+            local.pending.push_back(b);
+            std::ranges::push_heap(local.pending, std::greater{});
+        }
+
+        slot.push_back(v_i);
+        ws_->extra().queued[v_i] = true;
+    }
+
+    // all buckets in use are in [current_, current_ + local.buckets.size())
+    static std::size_t index(const Local &local, std::size_t b) noexcept
+    {
+        return b & (local.buckets.size() - 1);
+    }
+
+    void grow(Local &local, std::size_t min_size) const
+    {
+        std::vector<std::vector<size_type>> buckets(std::bit_ceil(min_size));
+        std::swap(buckets, local.buckets);
+        const std::size_t old_mask = buckets.size() - 1;
+
+        for (auto j : std::views::iota(0uz, buckets.size()))
+        {
+            const std::size_t b = current_ + ((j - current_) & old_mask);
+            local.buckets[index(local, b)] = std::move(buckets[j]);
+        }
+    }
+
+    // Relaxes light edges of the vertices of the current bucket of the thread. Returns whether a
+    // negative weight has been met
+    bool scan_light(const G &g, Local &local)
+    {
+        bool negative = false;
+        state_type &state = ws_->extra();
+
+        local.scanned.clear();
+        if (!local.buckets.empty())
+            std::swap(local.scanned, local.buckets[index(local, current_)]);
+
+        for (auto u_i : local.scanned)
+        {
+            // a vertex may be queued in another bucket now, or it may have been scanned since it
+            // was queued last time
+            if (!state.queued[u_i] || bucket(ws_->distance(u_i)) != current_)
+                continue;
+
+            state.queued[u_i] = false;
+            if (!state.settled[u_i])
+            {
+                state.settled[u_i] = true;
+                local.settled.push_back(u_i);
+            }
+
+            const distance_type u_d = ws_->distance(u_i);
+
+            for (auto [v_i, w] : adjacent_edges<Traits>(g, u_i))
+            {
+                if (w < 0)
+                    negative = true;
+                else if (w <= delta_)
+                    local.outbox[owner(v_i)].push_back(Request{v_i, u_d + w, u_i});
+            }
+        }
+
+        return negative;
+    }
+
+    // relaxes heavy edges of the vertices which have left the current bucket
+    void scan_heavy(const G &g, Local &local)
+    {
+        for (auto u_i : local.settled)
+        {
+            ws_->extra().settled[u_i] = false;
+
+            const distance_type u_d = ws_->distance(u_i);
+
+            for (auto [v_i, w] : adjacent_edges<Traits>(g, u_i))
+            {
+                if (w > delta_)
+                    local.outbox[owner(v_i)].push_back(Request{v_i, u_d + w, u_i});
+            }
+        }
+
+        local.settled.clear();
+    }
+
+    // Applies requests sent to thread t. Returns whether a vertex has been put to the current
+    // bucket
+    bool apply(unsigned t)
+    {
+        state_type &state = ws_->extra();
+        Local &local = state.locals[t];
+
+        for (auto &sender : state.locals)
+        {
+            for (const auto &[v_i, d, u_i] : sender.outbox[t])
+            {
+                const distance_type old_d = ws_->distance(v_i);
+                if (!(d < old_d))
+                    continue;
+
+                if (!state.dirty[v_i])
+                {
+                    state.dirty[v_i] = true;
+                    local.dirty.emplace_back(v_i, old_d);
+                }
+
+                if (old_d.is_inf())
+                    local.touched.push_back(v_i);
+
+                ws_->set_distance_unrecorded(v_i, d, u_i);
+            }
+
+            sender.outbox[t].clear();
+        }
+
+        bool refilled = false;
+
+        for (auto [v_i, old_d] : local.dirty)
+        {
+            state.dirty[v_i] = false;
+
+            // a queued vertex is in the bucket of its old distance
+            const std::size_t b = bucket(ws_->distance(v_i));
+            if (state.queued[v_i] && bucket(old_d) == b)
+                continue;
+
+            insert(local, v_i);
+            refilled = refilled || b == current_;
+        }
+
+        local.dirty.clear();
+
+        return refilled;
+    }
+
+    std::size_t next_bucket(Local &local) const
+    {
+        while (!local.pending.empty() && local.pending.front() <= current_)
+        {
+            std::ranges::pop_heap(local.pending, std::greater{});
+            local.pending.pop_back();
+        }
+
+        return local.pending.empty() ? no_bucket : local.pending.front();
+    }
+
+    weight_type delta_{};
+    unsigned n_threads_ = 1;
+    std::size_t current_ = 0; // the bucket being processed
+    bool negative_weights_ = false;
+    workspace_type *ws_ = nullptr; // the workspace of the current run
+};
+
+} // namespace graphs
+
+#endif // INCLUDE_ALGORITHMS_DELTA_STEPPING_HPP
@@ -2,10 +2,10 @@
 #define INCLUDE_ALGORITHMS_DFS_HPP
 
 #include <cstddef>
+#include <limits>
 #include <stack>
+#include <span>
 #include <vector>
-#include <unordered_map>
-#include <optional>
 #include <ranges>
 
 #include "utils/graph_traits.hpp"
@@ -20,35 +20,27 @@ class DFS final
 {
 public:
 
+    using size_type = typename Traits::size_type;
     using time_type = std::size_t;
 
+    // the predecessor of roots of the depth-first forest
+    static constexpr size_type nil = std::numeric_limits<size_type>::max();
+
 private:
 
-    using size_type = typename Traits::size_type;
     using stack_type = std::stack<size_type, std::vector<size_type>>;
 
-    enum class Color { white, gray };
-
-    using color_table_type = std::unordered_map<size_type, Color>;
-
-    struct Info_Node final
-    {
-        std::optional<size_type> predecessor;
-        time_type discovery_time;
-        time_type finished_time;
-    };
-
 public:
 
     DFS(const G &g)
     {
-        auto color_table = dfs_init(g);
+        std::vector<bool> gray = dfs_init(g);
         time_type time = 0;
 
         // s_ stands for "source"
         for (auto s_i : std::views::iota(size_type{0}, Traits::n_vertices(g)))
         {
-            if (color_table[s_i] == Color::white)
+            if (!gray[s_i])
             {
                 stack_type stack;
                 stack.push(s_i);
@@ -56,27 +48,25 @@ public:
                 while(!stack.empty())
                 {
                     const size_type u_i = stack.top();
-                    Info_Node &u_info = info_.find(u_i)->second;
 
-                    if (color_table[u_i] == Color::white)
+                    if (!gray[u_i])
                     {
-                        color_table[u_i] = Color::gray;
+                        gray[u_i] = true;
 
-                        u_info.discovery_time = ++time;
+                        discovery_times_[u_i] = ++time;
 
                         for (auto v_i : Traits::adjacent_vertices(g, u_i))
                         {
-                            if (color_table[v_i] == Color::white)
+                            if (!gray[v_i])
                             {
-                                Info_Node &v_info = info_.find(v_i)->second;
-                                v_info.predecessor = u_i;
+                                predecessors_[v_i] = u_i;
                                 stack.push(v_i);
                             }
                         }
                     }
                     else
                     {
-                        u_info.finished_time = ++time;
+                        finished_times_[u_i] = ++time;
                         stack.pop();
                     }
                 }
@@ -86,60 +76,59 @@ public:
 
     DFS(const G &g, recursive)
     {
-        auto color_table = dfs_init(g);
+        std::vector<bool> gray = dfs_init(g);
         time_type time = 0;
 
         for (auto s_i : std::views::iota(size_type{0}, Traits::n_vertices(g)))
-            if (color_table[s_i] == Color::white)
-                time = visit(g, color_table, s_i, time);
+            if (!gray[s_i])
+                time = visit(g, gray, s_i, time);
     }
 
-    time_type discovery_time(size_type i) const { return info_.at(i).discovery_time; }
-    time_type finished_time(size_type i) const { return info_.at(i).finished_time; }
+    time_type discovery_time(size_type i) const { return discovery_times_.at(i); }
+    time_type finished_time(size_type i) const { return finished_times_.at(i); }
+    size_type predecessor(size_type i) const { return predecessors_.at(i); }
+
+    // times and predecessors of all vertices indexed by vertex indices
+    std::span<const time_type> discovery_times() const noexcept { return discovery_times_; }
+    std::span<const time_type> finished_times() const noexcept { return finished_times_; }
+    std::span<const size_type> predecessors() const noexcept { return predecessors_; }
 
 private:
 
-    color_table_type dfs_init(const G &g)
+    // returns the table of colors: a vertex is gray once it's discovered
+    std::vector<bool> dfs_init(const G &g)
     {
-        color_table_type color_table;
-
         const size_type n_vertices = Traits::n_vertices(g);
-        info_.reserve(n_vertices);
-        color_table.reserve(n_vertices);
 
-        for (auto i : std::views::iota(size_type{0}, n_vertices))
-        {
-            info_.try_emplace(i);
-            color_table.try_emplace(i, Color::white);
-        }
+        predecessors_.assign(n_vertices, nil);
+        discovery_times_.assign(n_vertices, 0);
+        finished_times_.assign(n_vertices, 0);
 
-        return color_table;
+        return std::vector<bool>(n_vertices);
     }
 
-    time_type visit(const G &g, color_table_type &color_table, size_type u_i, time_type time)
+    time_type visit(const G &g, std::vector<bool> &gray, size_type u_i, time_type time)
     {
-        color_table[u_i] = Color::gray;
-
-        Info_Node &u_info = info_.find(u_i)->second;
-        u_info.discovery_time = ++time;
+        gray[u_i] = true;
+        discovery_times_[u_i] = ++time;
 
         for (auto v_i : Traits::adjacent_vertices(g, u_i))
         {
-            if (color_table[v_i] == Color::white)
+            if (!gray[v_i])
             {
-                Info_Node &v_info = info_.find(v_i)->second;
-                v_info.predecessor = u_i;
-
-                time = visit(g, color_table, v_i, time);
+                predecessors_[v_i] = u_i;
+                time = visit(g, gray, v_i, time);
             }
         }
 
-        u_info.finished_time = ++time;
+        finished_times_[u_i] = ++time;
 
         return time;
     }
 
-    std::unordered_map<size_type, Info_Node> info_;
+    std::vector<size_type> predecessors_;
+    std::vector<time_type> discovery_times_;
+    std::vector<time_type> finished_times_;
 };
 
 } // namespace graphs
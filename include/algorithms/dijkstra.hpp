@@ -2,14 +2,11 @@
 #define INCLUDE_ALGORITHMS_DIJKSTRA_HPP
 
 #include <stdexcept>
-#include <utility>
-#include <vector>
 #include <ranges>
 #include <algorithm>
 
-#include <boost/heap/fibonacci_heap.hpp>
-
 #include "utils/graph_traits.hpp"
+#include "utils/vertex_queue.hpp"
 #include "single_source_shortest_paths.hpp"
 
 namespace graphs
@@ -22,85 +19,106 @@ struct Negative_Weights : public std::logic_error
                            "for graphs with non-negative weights"} {};
 };
 
-template<typename G, typename Traits = graph_traits<G>> // G stands for "graph"
-class Dijkstra final : public SSSP<G, Traits>
+// Only vertices reachable from the source are visited, so a run with a workspace costs
+// O(E' + V' * log(V')) where V' and E' are the numbers of reachable vertices and edges. Queue is
+// one of the policies of priority queues described in utils/vertex_queue.hpp.
+template<typename G, typename Traits = graph_traits<G>, // G stands for "graph"
+         typename Queue = default_queue<typename Traits::weight_type>>
+class Dijkstra final
+    : public SSSP<G, Traits, Vertex_Queue<Queue, typename Traits::size_type,
+                                         Distance<typename Traits::weight_type>>>
 {
-    using sssp = SSSP<G, Traits>;
-    using sssp::info_;
+    using queue_type = Vertex_Queue<Queue, typename Traits::size_type,
+                                    Distance<typename Traits::weight_type>>;
+    using sssp = SSSP<G, Traits, queue_type>;
     using typename sssp::size_type;
-    using typename sssp::Info_Node;
 
 public:
 
     using typename sssp::distance_type;
+    using typename sssp::workspace_type;
+    using queue_policy = Queue;
 
-private:
+    // Throws Negative_Weights if an edge with negative weight is reachable from the source
+    Dijkstra(const G &g, size_type source_i) : sssp{g, source_i} { run(g, source_i); }
+
+    Dijkstra(const G &g, size_type source_i, workspace_type &ws) : sssp{g, source_i, &ws}
+    {
+        run(g, source_i);
+    }
 
-    using priority_pair = std::pair<size_type, distance_type>;
+    // The run stops as soon as the target is settled, so only vertices nearer to the source than
+    // the target are settled. Distances and paths to the target and to the settled vertices are
+    // exact; other finite distances are only upper bounds.
+    Dijkstra(const G &g, size_type source_i, size_type target_i) : sssp{g, source_i}
+    {
+        this->ws().check_index(target_i);
+        run(g, source_i, target_i);
+    }
+
+    Dijkstra(const G &g, size_type source_i, size_type target_i, workspace_type &ws)
+        : sssp{g, source_i, &ws}
+    {
+        this->ws().check_index(target_i);
+        run(g, source_i, target_i);
+    }
 
-    // we cannot mark this class final because boost inherits from it
-    struct priority_comp
+    static bool has_negative_weights(const G &g)
     {
-        bool operator()(const priority_pair &lhs, const priority_pair &rhs) const
+        const size_type n_vertices = Traits::n_vertices(g);
+
+        for (auto u_i : std::views::iota(size_type{0}, n_vertices))
         {
-            return lhs.second > rhs.second;
+            auto cond = [](const auto &edge){ return edge.second < 0; };
+
+            if (std::ranges::any_of(adjacent_edges<Traits>(g, u_i), cond))
+                return true;
         }
-    };
 
-public:
+        return false;
+    }
 
-    Dijkstra(const G &g, size_type source_i) : sssp{g, source_i}
-    {
-        if (has_negative_weights(g))
-            throw Negative_Weights{};
+private:
 
-        boost::heap::fibonacci_heap<priority_pair,
-                                    boost::heap::compare<priority_comp>> Q;
-        using handle_type = decltype(Q)::handle_type;
+    void run(const G &g, size_type source_i, size_type target_i = sssp::nil)
+    {
+        workspace_type &ws = this->ws();
 
-        std::vector<handle_type> handles;
-        handles.reserve(Traits::n_vertices(g));
+        // Vertices are pushed to the queue when they are discovered, i.e. get finite distances.
+        // A vertex with finite distance which decreases can't have been popped yet since
+        // weights are non-negative, so it's still in the queue
 
-        for (const auto &[u_i, node] : info_)
-            handles[u_i] = Q.emplace(u_i, node.distance);
+        queue_type &Q = ws.extra();
+        Q.reset(ws.n_vertices());
+        Q.push(source_i, 0);
 
         while (!Q.empty())
         {
-            const auto [u_i, u_d] = Q.top();
-            Q.pop();
+            const auto [u_i, u_d] = Q.pop();
+            if (ws.distance(u_i) < u_d)
+                continue; // a stale entry of a queue with lazy decrease-key
 
-            const Info_Node &u_info = info_.find(u_i)->second;
+            if (u_i == target_i)
+                break;
 
-            for (auto v_i : Traits::adjacent_vertices(g, u_i))
+            for (auto [v_i, w] : adjacent_edges<Traits>(g, u_i))
             {
-                Info_Node &v_info = info_.find(v_i)->second;
+                if (w < 0)
+                    throw Negative_Weights{};
 
-                if (distance_type d = u_info.distance + Traits::weight(g, u_i, v_i);
-                    d < v_info.distance)
+                if (distance_type d = u_d + w; d < ws.distance(v_i))
                 {
-                    v_info.distance = d;
-                    v_info.predecessor = u_i;
+                    const bool queued = !ws.distance(v_i).is_inf();
+                    ws.set_distance(v_i, d, u_i);
 
-                    Q.decrease(handles[v_i], std::pair{v_i, *d});
+                    if (queued)
+                        Q.decrease(v_i, d);
+                    else
+                        Q.push(v_i, d);
                 }
             }
         }
     }
-
-    static bool has_negative_weights(const G &g)
-    {
-        const size_type n_vertices = Traits::n_vertices(g);
-
-        for (auto u_i : std::views::iota(size_type{0}, n_vertices))
-        {
-            auto cond = [&g, u_i](size_type v_i){ return Traits::weight(g, u_i, v_i) < 0; };
-
-            if (std::ranges::any_of(Traits::adjacent_vertices(g, u_i), cond))
-                return true;
-        }
-
-        return false;
-    }
 };
 
 } // namespace graphs
@@ -1,46 +1,49 @@
 #ifndef INCLUDE_ALGORITHMS_JOHNSON_HPP
 #define INCLUDE_ALGORITHMS_JOHNSON_HPP
 
-#include <type_traits>
 #include <cstddef>
 #include <functional>
 #include <iterator>
 #include <ranges>
-#include <unordered_map>
-
-#include <boost/container_hash/hash.hpp>
+#include <vector>
+#include <stdexcept>
+#include <format>
 
 #include "utils/graph_traits.hpp"
 #include "utils/distance.hpp"
+#include "utils/reweighted_graph.hpp"
 #include "bellman_ford.hpp"
 #include "dijkstra.hpp"
 
 namespace graphs
 {
 
-template<typename G, typename Traits = graph_traits<G>,
-         typename = std::enable_if_t<Traits::is_directed>> // G stands for "graph"
+// Queue is the policy of the priority queue of Dijkstra's algorithm run on the reweighted graph
+// (see utils/vertex_queue.hpp); reweighting keeps integral weights integral, so radix_heap and
+// dial_buckets can be used for them. Potentials is the mode of Bellman-Ford algorithm which
+// computes the potentials (see bellman_ford.hpp); parallel_rounds uses all cores for it.
+template<typename G, typename Traits = graph_traits<G>, // G stands for "graph"
+         typename Queue = default_queue<typename Traits::weight_type>,
+         bellman_ford_mode Potentials = fifo_queue>
+requires Traits::is_directed
 class Johnson final
 {
     using weight_type = typename Traits::weight_type;
-    using vertex_type = typename Traits::vertex_type;
     using size_type = typename Traits::size_type;
 
 public:
 
     using distance_type = Distance<weight_type>;
 
-    Johnson(G g)
+    // Bellman-Ford algorithm is run from a virtual source instead of a vertex added to g, and
+    // Dijkstra's algorithm is run on a view of g which applies the potentials to weights, so g is
+    // neither copied nor changed
+    Johnson(const G &g, Potentials potentials = {})
     {
-        const size_type s_i = add_source_vertex(g);
-        const Bellman_Ford bellman_ford{g, s_i};
-        g.erase_vertex(s_i);
+        const Bellman_Ford<G, Traits, Potentials> bellman_ford{g, virtual_source{}, potentials};
 
         if (!bellman_ford.has_negative_weight_cycles())
-        {
-            reweight(g, bellman_ford);
             compute_shortest_paths(g, bellman_ford);
-        }
     }
 
     bool has_negative_weight_cycles() const noexcept { return storage_.empty(); }
@@ -49,67 +52,49 @@ public:
 
     distance_type distance(size_type from, size_type to) const
     {
-        return storage_.at(std::pair{from, to});
+        if (from >= n_vertices_ || to >= n_vertices_)
+            throw std::out_of_range{std::format("no path from vertex {} to vertex {}", from, to)};
+        return storage_[from * n_vertices_ + to];
     }
 
 private:
 
-    size_type add_source_vertex(G &g) const
-    {
-        const size_type s_i = g.insert_vertex(vertex_type{});
-
-        for (auto i : std::views::iota(size_type{0}, s_i))
-            g.insert_edge(s_i, i, 0);
-
-        for (auto i : std::views::iota(s_i, Traits::n_vertices(g)))
-            g.insert_edge(s_i, i, 0);
-
-        return s_i;
-    }
+    using reweighted_graph = Reweighted_Graph<G, Traits>;
+    using reweighted_traits = graph_traits<reweighted_graph>;
 
-    static void reweight(G &g, const Bellman_Ford<G> &bellman_ford)
+    void compute_shortest_paths(const G &g,
+                                const Bellman_Ford<G, Traits, Potentials> &bellman_ford)
     {
         // We can easily call operator*() on objects of type distance_type because
-        // there is definitely a path from S to every other vertex
+        // there is definitely a path from the virtual source to every other vertex
 
         const size_type n_vertices = Traits::n_vertices(g);
+        n_vertices_ = n_vertices;
 
+        std::vector<weight_type> h(n_vertices);
         for (auto u_i : std::views::iota(size_type{0}, n_vertices))
-        {
-            const weight_type h_u = *bellman_ford.distance(u_i);
+            h[u_i] = *bellman_ford.distance(u_i);
 
-            for (auto v_i : Traits::adjacent_vertices(g, u_i))
-            {
-                const weight_type h_v = *bellman_ford.distance(v_i);
-                g.change_weight(u_i, v_i, g.weight(u_i, v_i) + (h_u - h_v));
-            }
-        }
-    }
+        const reweighted_graph reweighted{g, h};
 
-    void compute_shortest_paths(const G &g, const Bellman_Ford<G> &bellman_ford)
-    {
-        // We can easily call operator*() on objects of type distance_type because
-        // there is definitely a path from S to every other vertex
-
-        auto n_vertices = Traits::n_vertices(g);
         storage_.reserve(n_vertices * n_vertices);
 
+        // one workspace serves all runs of Dijkstra's algorithm
+        typename Dijkstra<reweighted_graph, reweighted_traits, Queue>::workspace_type ws;
+
         for (auto u_i : std::views::iota(size_type{0}, n_vertices))
         {
-            const Dijkstra dijkstra{g, u_i};
-            const weight_type h_u = *bellman_ford.distance(u_i);
+            const Dijkstra<reweighted_graph, reweighted_traits, Queue>
+                dijkstra{reweighted, u_i, ws};
 
             for (auto v_i : std::views::iota(size_type{0}, n_vertices))
-            {
-                const weight_type h_v = *bellman_ford.distance(v_i);
-                storage_[std::pair{u_i, v_i}] = dijkstra.distance(v_i) + (h_v - h_u);
-            }
+                storage_.push_back(dijkstra.distance(v_i) + (h[v_i] - h[u_i]));
         }
     }
 
-    std::unordered_map<std::pair<size_type, size_type>,
-                       distance_type,
-                       boost::hash<std::pair<size_type, size_type>>> storage_;
+    // distances between all pairs of vertices are stored, so a dense row-major matrix is used
+    std::vector<distance_type> storage_;
+    size_type n_vertices_ = 0;
 };
 
 } // namespace graphs
@@ -1,84 +1,94 @@
 #ifndef INCLUDE_ALGORITHMS_SINGLE_SOURCE_SHORTEST_PATHS
 #define INCLUDE_ALGORITHMS_SINGLE_SOURCE_SHORTEST_PATHS
 
-#include <type_traits>
-#include <optional>
-#include <iterator>
-#include <cstddef>
-#include <unordered_map>
+#include <span>
 #include <vector>
-#include <algorithm>
+#include <variant>
+#include <ranges>
 
 #include "utils/graph_traits.hpp"
 #include "utils/distance.hpp"
+#include "utils/workspace.hpp"
 
 namespace graphs
 {
 
-template<typename G, typename Traits = graph_traits<G>,
-         typename = std::enable_if_t<Traits::is_directed>> // G stands for "graph"
+// Undirected graphs are treated as directed ones with two opposite edges instead of each
+// undirected edge.
+//
+// Results are stored either in a workspace owned by the object or in a workspace passed by the
+// user. In the latter case they are valid until the workspace is reset by another run.
+template<typename G, typename Traits = graph_traits<G>, // G stands for "graph"
+         typename Extra = std::monostate>
 class SSSP // single-source shortest paths
 {
-protected:
+public:
 
     using size_type = typename Traits::size_type;
     using weight_type = typename Traits::weight_type;
     using distance_type = Distance<weight_type>;
+    using workspace_type = Workspace<distance_type, size_type, Extra>;
 
-    struct Info_Node final
-    {
-        distance_type distance;
-        std::optional<size_type> predecessor;
+    // the predecessor of sources and of unreachable vertices
+    static constexpr size_type nil = workspace_type::nil;
 
-        Info_Node() = default;
-        Info_Node(weight_type d) : distance{d} {}
-    };
+protected:
 
-    SSSP(const G &g, size_type source_i)
+    SSSP(const G &g, size_type source_i, workspace_type *borrowed = nullptr)
+        : borrowed_{borrowed}
     {
-        const size_type n_vertices = Traits::n_vertices(g);
-        info_.reserve(n_vertices);
-
-        for (auto i : std::views::iota(size_type{0}, source_i))
-            info_.try_emplace(i);
+        ws().reset(Traits::n_vertices(g));
+        ws().check_index(source_i);
+        ws().set_distance(source_i, 0);
+    }
 
-        info_.try_emplace(source_i, 0);
+    // Every vertex is a source. This is equivalent to running the algorithm from a virtual vertex
+    // connected to all vertices of the graph with zero-weight edges.
+    explicit SSSP(const G &g, workspace_type *borrowed = nullptr)
+        : borrowed_{borrowed}
+    {
+        const size_type n_vertices = Traits::n_vertices(g);
+        ws().reset(n_vertices);
 
-        for (auto i : std::views::iota(source_i + 1, n_vertices))
-            info_.try_emplace(i);
+        for (auto i : std::views::iota(size_type{0}, n_vertices))
+            ws().set_distance(i, 0);
     }
 
     // No need in virtual destructor since the destructor is protected
     ~SSSP() = default;
 
+    // the workspace a run stores results in
+    workspace_type &ws() noexcept { return borrowed_ ? *borrowed_ : own_; }
+
 public:
 
-    distance_type distance(size_type u_i) const { return info_.at(u_i).distance; }
+    const workspace_type &workspace() const noexcept { return borrowed_ ? *borrowed_ : own_; }
 
-    std::vector<size_type> path_to(size_type u_i) const
+    distance_type distance(size_type u_i) const
     {
-        distance_type u_d = distance(u_i);
-        if (u_d.is_inf())
-            return {};
-
-        std::vector path{u_i};
-
-        for (auto predecessor = info_.find(u_i)->second.predecessor; predecessor.has_value();)
-        {
-            u_i = *predecessor;
-            predecessor = info_.find(u_i)->second.predecessor;
-
-            path.push_back(u_i);
-        }
+        workspace().check_index(u_i);
+        return workspace().distance(u_i);
+    }
 
-        std::ranges::reverse(path);
+    size_type predecessor(size_type u_i) const
+    {
+        workspace().check_index(u_i);
+        return workspace().predecessor(u_i);
+    }
 
-        return path;
+    // distances and predecessors of all vertices indexed by vertex indices
+    std::span<const distance_type> distances() const noexcept { return workspace().distances(); }
+    std::span<const size_type> predecessors() const noexcept
+    {
+        return workspace().predecessors();
     }
 
-protected:
+    std::vector<size_type> path_to(size_type u_i) const { return workspace().path_to(u_i); }
+
+private:
 
-    std::unordered_map<size_type, Info_Node> info_;
+    workspace_type own_;
+    workspace_type *borrowed_ = nullptr;
 };
 
 } // namespace graphs
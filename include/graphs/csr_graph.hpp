@@ -0,0 +1,333 @@
+#ifndef INCLUDE_GRAPHS_CSR_GRAPH_HPP
+#define INCLUDE_GRAPHS_CSR_GRAPH_HPP
+
+#include <cstddef>
+#include <vector>
+#include <span>
+#include <iterator>
+#include <algorithm>
+#include <ranges>
+#include <initializer_list>
+#include <numeric>
+#include <utility>
+#include <tuple>
+#include <ostream>
+#include <stdexcept>
+#include <format>
+#include <print>
+
+#include "utils/graph_traits.hpp"
+#include "graphs/directed_graph.hpp"
+
+namespace graphs
+{
+
+// Immutable directed graph in compressed sparse row format: out-edges of the vertex with index i
+// occupy positions [offsets_[i], offsets_[i + 1]) of targets_ and weights_ and are sorted by
+// target.
+//
+// Note: duplicate edges are ignored; the weight of the first occurrence is kept.
+
+template<typename T, arithmetic W = int>
+class CSR_Graph final
+{
+    using vertex_cont = std::vector<T>;
+
+public:
+
+    using vertex_type = T;
+    using size_type = typename vertex_cont::size_type;
+    using const_iterator = typename vertex_cont::const_iterator;
+    using const_reference = const vertex_type &;
+    using weight_type = W;
+
+    static constexpr weight_type default_weight = Directed_Graph<T, W>::default_weight;
+
+    CSR_Graph() = default;
+
+    // O(V + E * log(E / V))
+    template<typename Adjacency>
+    explicit CSR_Graph(const Directed_Graph<T, W, Adjacency> &g) : vertices_(g.begin(), g.end())
+    {
+        const size_type n_vertices = g.n_vertices();
+
+        offsets_.reserve(n_vertices + 1);
+        for (auto i : std::views::iota(size_type{0}, n_vertices))
+            offsets_.push_back(offsets_.back() + g.vertex_out_degree(i));
+
+        targets_.reserve(offsets_.back());
+        weights_.reserve(offsets_.back());
+
+        std::vector<std::pair<size_type, weight_type>> row;
+        for (auto i : std::views::iota(size_type{0}, n_vertices))
+        {
+            row.clear();
+            std::ranges::copy(g.adjacent_edges(i), std::back_inserter(row));
+            std::ranges::sort(row, {}, &std::pair<size_type, weight_type>::first);
+
+            for (const auto &[to_i, w] : row)
+            {
+                targets_.push_back(to_i);
+                weights_.push_back(w);
+            }
+        }
+
+        count_in_degrees();
+    }
+
+    // Edges are given either as (from, to, weight) or as (from, to) tuple-like objects where
+    // "from" and "to" are indices of vertices in range [v_first, v_last).
+    // O(V + E * log(E / V))
+    template<std::input_iterator VIt, std::forward_iterator EIt>
+    CSR_Graph(VIt v_first, VIt v_last, EIt e_first, EIt e_last)
+        : vertices_(v_first, v_last)
+    {
+        using edge_init = typename std::iterator_traits<EIt>::value_type;
+
+        const size_type n_vertices = vertices_.size();
+
+        // counting sort of edges by their tails
+
+        offsets_.assign(n_vertices + 1, 0);
+        for (auto it = e_first; it != e_last; ++it)
+        {
+            check_index(std::get<0>(*it));
+            check_index(std::get<1>(*it));
+            ++offsets_[std::get<0>(*it) + 1];
+        }
+
+        std::partial_sum(offsets_.begin(), offsets_.end(), offsets_.begin());
+
+        std::vector<size_type> positions(offsets_.begin(), std::prev(offsets_.end()));
+        std::vector<std::pair<size_type, weight_type>> edges(offsets_.back());
+
+        for (; e_first != e_last; ++e_first)
+        {
+            weight_type w = default_weight;
+            if constexpr (std::tuple_size_v<edge_init> == 3)
+                w = std::get<2>(*e_first);
+
+            edges[positions[std::get<0>(*e_first)]++] = std::pair{std::get<1>(*e_first), w};
+        }
+
+        // sorting each row by heads and removing duplicates
+
+        targets_.reserve(edges.size());
+        weights_.reserve(edges.size());
+
+        size_type row_first = 0;
+        for (auto i : std::views::iota(size_type{0}, n_vertices))
+        {
+            auto first = std::next(edges.begin(), row_first);
+            auto last = std::next(edges.begin(), offsets_[i + 1]);
+            std::stable_sort(first, last,
+                             [](const auto &lhs, const auto &rhs){ return lhs.first < rhs.first; });
+
+            row_first = offsets_[i + 1];
+            offsets_[i + 1] = offsets_[i];
+
+            for (auto it = first; it != last; ++it)
+            {
+                if (offsets_[i + 1] != offsets_[i] && targets_.back() == it->first)
+                    continue;
+
+                targets_.push_back(it->first);
+                weights_.push_back(it->second);
+                ++offsets_[i + 1];
+            }
+        }
+
+        count_in_degrees();
+    }
+
+    CSR_Graph(std::initializer_list<vertex_type> vertices,
+              std::initializer_list<std::tuple<size_type, size_type, weight_type>> edges)
+        : CSR_Graph(vertices.begin(), vertices.end(), edges.begin(), edges.end()) {}
+
+    CSR_Graph(std::initializer_list<vertex_type> vertices,
+              std::initializer_list<std::pair<size_type, size_type>> edges)
+        : CSR_Graph(vertices.begin(), vertices.end(), edges.begin(), edges.end()) {}
+
+    size_type n_vertices() const noexcept { return vertices_.size(); }
+    size_type n_edges() const noexcept { return targets_.size(); }
+
+    bool empty() const noexcept { return n_vertices() == 0; }
+
+    const_iterator begin() const { return vertices_.begin(); }
+    const_iterator cbegin() const { return begin(); }
+
+    const_iterator end() const { return vertices_.end(); }
+    const_iterator cend() const { return end(); }
+
+    // Operations on vertices
+
+    // O(1)
+    const_reference vertex(size_type vertex_i) const { return vertices_.at(vertex_i); }
+
+    // Operations on edges
+
+    // O(log(deg))
+    const weight_type &weight(size_type from_i, size_type to_i) const
+    {
+        return weights_[find_edge(from_i, to_i)];
+    }
+
+    // Mixed operations
+
+    // O(log(deg))
+    bool are_adjacent(size_type from_i, size_type to_i) const
+    {
+        auto row = adjacent_vertices(from_i);
+        return std::ranges::binary_search(row, to_i);
+    }
+
+    // O(1)
+    std::span<const size_type> adjacent_vertices(size_type vertex_i) const
+    {
+        check_index(vertex_i);
+        return std::span{targets_}.subspan(offsets_[vertex_i],
+                                           offsets_[vertex_i + 1] - offsets_[vertex_i]);
+    }
+
+    // O(1)
+    std::span<const weight_type> adjacent_weights(size_type vertex_i) const
+    {
+        check_index(vertex_i);
+        return std::span{weights_}.subspan(offsets_[vertex_i],
+                                           offsets_[vertex_i + 1] - offsets_[vertex_i]);
+    }
+
+    // O(1)
+    auto adjacent_edges(size_type vertex_i) const
+    {
+        check_index(vertex_i);
+        return std::views::iota(offsets_[vertex_i], offsets_[vertex_i + 1]) |
+               std::views::transform([this](size_type j)
+               {
+                   return std::pair<size_type, const weight_type &>{targets_[j], weights_[j]};
+               });
+    }
+
+    // O(1)
+    std::size_t vertex_in_degree(size_type vertex_i) const
+    {
+        check_index(vertex_i);
+        return in_degrees_[vertex_i];
+    }
+
+    // O(1)
+    std::size_t vertex_out_degree(size_type vertex_i) const
+    {
+        check_index(vertex_i);
+        return offsets_[vertex_i + 1] - offsets_[vertex_i];
+    }
+
+    // O(1)
+    size_type vertex_degree(size_type vertex_i) const
+    {
+        return vertex_in_degree(vertex_i) + vertex_out_degree(vertex_i);
+    }
+
+    // graphic dump in dot format
+
+    void graphic_dump(std::ostream &os) const
+    {
+        os << "digraph G\n"
+              "{\n";
+
+        for (auto i : std::views::iota(size_type{0}, n_vertices()))
+            std::println(os, "    node_{} [label = \"{}\"];", i, vertices_[i]);
+
+        os << '\n';
+
+        for (auto from_i : std::views::iota(size_type{0}, n_vertices()))
+            for (auto j : std::views::iota(offsets_[from_i], offsets_[from_i + 1]))
+                std::println(os, "    node_{} -> node_{} [label = \"{}\"];", from_i, targets_[j],
+                             weights_[j]);
+
+        os << "}\n";
+    }
+
+private:
+
+    void check_index(size_type vertex_i) const
+    {
+        if (vertex_i >= n_vertices())
+            throw std::out_of_range{std::format("no vertex with index {}", vertex_i)};
+    }
+
+    void count_in_degrees()
+    {
+        in_degrees_.assign(n_vertices(), 0);
+        for (auto to_i : targets_)
+            ++in_degrees_[to_i];
+    }
+
+    size_type find_edge(size_type from_i, size_type to_i) const
+    {
+        auto row = adjacent_vertices(from_i);
+        auto it = std::ranges::lower_bound(row, to_i);
+        if (it == row.end() || *it != to_i)
+            throw std::out_of_range{
+                std::format("no edge from vertex {} to vertex {}", from_i, to_i)};
+        return offsets_[from_i] + (it - row.begin());
+    }
+
+    vertex_cont vertices_;
+    std::vector<size_type> offsets_{0};
+    std::vector<size_type> targets_;
+    std::vector<weight_type> weights_;
+    std::vector<size_type> in_degrees_;
+};
+
+template<typename T, typename W, typename Adjacency>
+CSR_Graph(const Directed_Graph<T, W, Adjacency> &) -> CSR_Graph<T, W>;
+
+template<std::input_iterator VIt, std::forward_iterator EIt>
+CSR_Graph(VIt v_first, VIt v_last, EIt e_first, EIt e_last)
+    -> CSR_Graph<typename std::iterator_traits<VIt>::value_type>;
+
+// the weight type is deduced from (from, to, weight) edges
+template<std::input_iterator VIt, std::forward_iterator EIt>
+requires (std::tuple_size_v<typename std::iterator_traits<EIt>::value_type> == 3)
+CSR_Graph(VIt v_first, VIt v_last, EIt e_first, EIt e_last)
+    -> CSR_Graph<typename std::iterator_traits<VIt>::value_type,
+                 std::tuple_element_t<2, typename std::iterator_traits<EIt>::value_type>>;
+
+template<typename T, typename W>
+struct graph_traits<CSR_Graph<T, W>>
+{
+private:
+
+    using G = CSR_Graph<T, W>;
+
+public:
+
+    using vertex_type = T;
+    using size_type = typename G::size_type;
+    using weight_type = typename G::weight_type;
+
+    static constexpr bool is_directed = true;
+
+    static size_type n_edges(const G &g) { return g.n_edges(); }
+    static size_type n_vertices(const G &g) { return g.n_vertices(); }
+
+    static auto adjacent_vertices(const G &g, size_type vertex_i)
+    {
+        return g.adjacent_vertices(vertex_i);
+    }
+
+    static auto adjacent_edges(const G &g, size_type vertex_i)
+    {
+        return g.adjacent_edges(vertex_i);
+    }
+
+    static const weight_type &weight(const G &g, size_type from, size_type to)
+    {
+        return g.weight(from, to);
+    }
+};
+
+} // namespace graphs
+
+#endif // INCLUDE_GRAPHS_CSR_GRAPH_HPP
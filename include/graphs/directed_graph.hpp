@@ -2,7 +2,6 @@
 #define INCLUDE_GRAPHS_DIRECTED_GRAPH_HPP
 
 #include <cstddef>
-#include <list>
 #include <iterator>
 #include <algorithm>
 #include <ranges>
@@ -11,23 +10,53 @@
 #include <utility>
 #include <tuple>
 #include <ostream>
+#include <print>
 #include <unordered_map>
-#include <unordered_set>
-
-#include <boost/container_hash/hash.hpp>
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <format>
+#include <span>
+#include <concepts>
+#include <type_traits>
 
 #include "utils/graph_traits.hpp"
+#include "utils/distance.hpp"
+#include "utils/edge_dedup.hpp"
 
 namespace graphs
 {
 
+// Policies of storing adjacency of Directed_Graph:
+// - hashed_adjacency: hash maps from adjacent vertices to weights of the edges. Insertion,
+//   erasure and lookup of an edge are O(1) on average, but traversal chases pointers;
+// - flat_adjacency: sorted vectors of adjacent vertices and parallel vectors of weights. Lookup
+//   of an edge is O(log(deg)), insertion and erasure are O(deg), and traversal is a sequential
+//   scan. Preferable for graphs that are built once and traversed many times.
+struct hashed_adjacency final {};
+struct flat_adjacency final {};
+
+template<typename A>
+concept adjacency_policy = std::same_as<A, hashed_adjacency> || std::same_as<A, flat_adjacency>;
+
 // Note: the order of vertices is preserved; all new vertices are inserted at the end of graph's
 //       internal container.
-
-template<typename T>
+//
+// Vertices are stored contiguously and indices of vertices are stable: erasing a vertex leaves a
+// tombstone in its place, so n_vertices() and iterators cover erased vertices too, and a new
+// vertex never gets the index of an erased one. Erased vertices have no edges. Only compact()
+// gets rid of tombstones and changes indices.
+//
+// Every vertex keeps both its outgoing and its incoming edges with their weights, so the transpose
+// of the graph can be traversed as fast as the graph itself.
+//
+// Complexities of operations on edges are given for hashed_adjacency / flat_adjacency.
+
+template<typename T, arithmetic W = int, adjacency_policy Adjacency = hashed_adjacency>
 class Directed_Graph final
 {
-    using vertex_cont = std::list<T>;
+    using vertex_cont = std::vector<T>;
 
 public:
 
@@ -35,8 +64,10 @@ public:
     using size_type = typename vertex_cont::size_type;
     using iterator = typename vertex_cont::iterator;
     using const_iterator = typename vertex_cont::const_iterator;
+    using reference = vertex_type &;
     using const_reference = const vertex_type &;
-    using weight_type = int;
+    using weight_type = W;
+    using adjacency_type = Adjacency;
 
     static constexpr weight_type default_weight = 1;
 
@@ -46,17 +77,20 @@ public:
     Directed_Graph(It first, It last)
     {
         std::ranges::copy(first, last, std::back_inserter(vertices_));
-        for (auto i : std::views::iota(size_type{0}, n_vertices()))
-            adjacency_list_.try_emplace(i);
+        adjacency_list_.resize(n_vertices());
+        incoming_.resize(n_vertices());
+        erased_.resize(n_vertices());
     }
 
     Directed_Graph(std::initializer_list<vertex_type> il) : Directed_Graph(il.begin(), il.end()) {}
 
+    // the number of vertices including erased ones; indices of vertices are less than it
     size_type n_vertices() const { return vertices_.size(); }
+    size_type n_erased_vertices() const { return std::ranges::count(erased_, true); }
     size_type n_edges() const
     {
         return std::accumulate(adjacency_list_.begin(), adjacency_list_.end(), size_type{0},
-                               [](size_type init, auto &elem){ return init + elem.second.size(); });
+                               [](size_type init, auto &row){ return init + heads(row).size(); });
     }
 
     bool empty() const { return n_vertices() == 0; }
@@ -65,6 +99,8 @@ public:
     {
         vertices_.clear();
         adjacency_list_.clear();
+        incoming_.clear();
+        erased_.clear();
     }
 
     iterator begin() { return vertices_.begin(); }
@@ -78,32 +114,104 @@ public:
     // Operations on vertices
 
     // O(1)
+    reference vertex(size_type vertex_i)
+    {
+        check_index(vertex_i);
+        return vertices_[vertex_i];
+    }
+
+    // O(1)
+    const_reference vertex(size_type vertex_i) const
+    {
+        check_index(vertex_i);
+        return vertices_[vertex_i];
+    }
+
+    // O(1)
+    bool is_erased(size_type vertex_i) const { return erased_.at(vertex_i); }
+
+    // amortized O(1)
     size_type insert_vertex(const_reference v)
     {
-        vertices_.emplace_back(v);
-        const size_type vertex_i = n_vertices() - 1;
-        adjacency_list_.try_emplace(vertex_i);
+        vertices_.push_back(v);
+        adjacency_list_.emplace_back();
+        incoming_.emplace_back();
+        erased_.push_back(false);
 
-        return vertex_i;
+        return n_vertices() - 1;
     }
 
-    // O(V)
+    // Indices of other vertices don't change, and the index of the erased vertex isn't reused
+    // (even if it's the last one) until compact() is called.
+    // O(deg(vertex_i))
     void erase_vertex(size_type vertex_i)
     {
-        for (auto &elem : adjacency_list_)
-            elem.second.erase(vertex_i);
+        check_index(vertex_i);
+
+        for (auto to_i : heads(adjacency_list_[vertex_i]))
+            erase_entry(incoming_[to_i], vertex_i);
+        adjacency_list_[vertex_i] = row_type{};
 
-        adjacency_list_.erase(vertex_i);
-        vertices_.erase(std::next(vertices_.begin(), vertex_i));
+        for (auto from_i : heads(incoming_[vertex_i]))
+            erase_entry(adjacency_list_[from_i], vertex_i);
+        incoming_[vertex_i] = row_type{};
+
+        erased_[vertex_i] = true;
+    }
+
+    // Removes tombstones of erased vertices and renumbers the remaining vertices preserving
+    // their order. The i-th element of the result is the new index of the vertex with index i
+    // or std::nullopt if that vertex was erased.
+    // O(V + E)
+    std::vector<std::optional<size_type>> compact()
+    {
+        std::vector<std::optional<size_type>> new_indices(n_vertices());
+
+        size_type n_alive = 0;
+        for (auto i : std::views::iota(size_type{0}, n_vertices()))
+        {
+            if (!erased_[i])
+                new_indices[i] = n_alive++;
+        }
+
+        if (n_alive == n_vertices())
+            return new_indices;
+
+        for (auto i : std::views::iota(size_type{0}, n_vertices()))
+        {
+            if (!new_indices[i].has_value())
+                continue;
+
+            const size_type new_i = *new_indices[i];
+
+            // vertices before the first tombstone stay in place; moving them onto themselves
+            // would leave them in a valid but unspecified state
+            if (new_i != i)
+                vertices_[new_i] = std::move(vertices_[i]);
+
+            adjacency_list_[new_i] = renumbered(std::move(adjacency_list_[i]), new_indices);
+            incoming_[new_i] = renumbered(std::move(incoming_[i]), new_indices);
+        }
+
+        vertices_.resize(n_alive);
+        adjacency_list_.resize(n_alive);
+        incoming_.resize(n_alive);
+        erased_.assign(n_alive, false);
+
+        return new_indices;
     }
 
     // Operations on edges
 
-    // O(1)
+    // If the edge already exists, its weight doesn't change.
+    // O(1) / O(deg)
     void insert_edge(size_type from_i, size_type to_i, weight_type w = default_weight)
     {
-        adjacency_list_[from_i].insert(to_i);
-        weights_.emplace(std::pair{from_i, to_i}, w);
+        check_index(from_i);
+        check_index(to_i);
+
+        if (insert_entry(adjacency_list_[from_i], to_i, w))
+            insert_entry(incoming_[to_i], from_i, w);
     }
 
     // O(il.size())
@@ -120,56 +228,102 @@ public:
             insert_edge(from, to);
     }
 
-    // O(1)
+    // Edges are given either as (from, to, weight) or as (from, to) tuple-like objects. Duplicates
+    // within [first, last) are removed by sorting (see utils/edge_dedup.hpp) before insertion;
+    // edges already present in the graph keep their weights.
+    // O(std::distance(first, last))
+    template<std::forward_iterator It>
+    void insert_edges(It first, It last, sorted_dedup opts)
+    {
+        using edge_init = typename std::iterator_traits<It>::value_type;
+
+        const auto n_edges = static_cast<size_type>(std::distance(first, last));
+
+        std::vector<std::uint64_t> keys;
+        keys.reserve(n_edges);
+
+        std::vector<weight_type> weights;
+        weights.reserve(n_edges);
+
+        for (; first != last; ++first)
+        {
+            keys.push_back(pack_edge(std::get<0>(*first), std::get<1>(*first)));
+
+            if constexpr (std::tuple_size_v<edge_init> == 3)
+                weights.push_back(std::get<2>(*first));
+            else
+                weights.push_back(default_weight);
+        }
+
+        auto kept = dedup_edges(std::move(keys), opts, [&weights](size_type i, size_type j)
+        {
+            return weights[i] < weights[j];
+        });
+
+        for (auto [key, i] : kept)
+        {
+            auto [from_i, to_i] = unpack_edge(key);
+            insert_edge(from_i, to_i, weights[i]);
+        }
+    }
+
+    // O(1) / O(deg)
     void erase_edge(size_type from_i, size_type to_i)
     {
-        adjacency_list_[from_i].erase(to_i);
-        weights_.erase(std::pair{from_i, to_i});
+        if (erase_entry(adjacency_list_.at(from_i), to_i))
+            erase_entry(incoming_[to_i], from_i);
     }
 
-    // O(1)
+    // O(1) / O(log(deg))
     const weight_type &weight(size_type from_i, size_type to_i) const
     {
-        return weights_.at(std::pair{from_i, to_i});
+        return edge_weight(*this, from_i, to_i);
     }
 
-    // O(1)
+    // O(1) / O(log(deg))
     void change_weight(size_type from_i, size_type to_i, weight_type new_w)
     {
-        weights_.at(std::pair{from_i, to_i}) = new_w;
+        edge_weight(*this, from_i, to_i) = new_w;
+        *find_entry(incoming_[to_i], from_i) = new_w;
     }
 
     // Mixed operations
 
-    // O(1)
+    // O(1) / O(log(deg))
     bool are_adjacent(size_type from_i, size_type to_i) const
     {
-        return adjacency_list_.at(from_i).contains(to_i);
+        if constexpr (flat)
+            return std::ranges::binary_search(adjacency_list_.at(from_i).heads, to_i);
+        else
+            return adjacency_list_.at(from_i).contains(to_i);
     }
 
-    // O(1)
-    auto adjacent_vertices(size_type vertex_i) const
-        -> std::ranges::subrange<typename std::unordered_set<size_type>::const_iterator>
-    {
-        return adjacency_list_.at(vertex_i);
-    }
+    // O(1); adjacent vertices are sorted in flat mode
+    auto adjacent_vertices(size_type vertex_i) const { return heads(adjacency_list_.at(vertex_i)); }
+
+    // O(1); returns a range of pairs (index of adjacent vertex, weight of the edge)
+    auto adjacent_edges(size_type vertex_i) const { return entries(adjacency_list_.at(vertex_i)); }
+
+    // O(1); returns a range of indices of tails of edges entering the vertex
+    auto incoming_vertices(size_type vertex_i) const { return heads(incoming_.at(vertex_i)); }
+
+    // O(1); returns a range of pairs (index of the tail, weight of the edge) of edges entering
+    // the vertex
+    auto incoming_edges(size_type vertex_i) const { return entries(incoming_.at(vertex_i)); }
 
-    // O(V)
+    // O(1)
     std::size_t vertex_in_degree(size_type vertex_i) const
     {
-        return std::ranges::count_if(adjacency_list_, [vertex_i](auto &elem)
-        {
-            return elem.second.contains(vertex_i);
-        });
+        return heads(incoming_.at(vertex_i)).size();
     }
 
     // O(1)
     std::size_t vertex_out_degree(size_type vertex_i) const
     {
-        return adjacency_list_.at(vertex_i).size();
+        return heads(adjacency_list_.at(vertex_i)).size();
     }
 
-    // O(V)
+    // O(1)
     size_type vertex_degree(size_type vertex_i) const
     {
         return vertex_in_degree(vertex_i) + vertex_out_degree(vertex_i);
@@ -182,52 +336,198 @@ public:
         os << "digraph G\n"
               "{\n";
 
-        auto it = begin();
         for (auto i : std::views::iota(size_type{0}, n_vertices()))
-            std::println(os, "    node_{} [label = \"{}\"];", i, *it++);
+        {
+            if (!erased_[i])
+                std::println(os, "    node_{} [label = \"{}\"];", i, vertices_[i]);
+        }
 
         os << '\n';
 
-        for (auto &[from_i, edges] : adjacency_list_)
-            for (auto to_i : edges)
-                std::println(os, "    node_{} -> node_{} [label = \"{}\"];", from_i, to_i,
-                             weights_.at(std::pair{from_i, to_i}));
+        for (auto from_i : std::views::iota(size_type{0}, n_vertices()))
+            for (auto [to_i, w] : adjacent_edges(from_i))
+                std::println(os, "    node_{} -> node_{} [label = \"{}\"];", from_i, to_i, w);
 
         os << "}\n";
     }
 
 private:
 
-    vertex_cont vertices_;
-    std::unordered_map<size_type,
-                       std::unordered_set<size_type>> adjacency_list_;
+    void check_index(size_type vertex_i) const
+    {
+        if (vertex_i >= n_vertices() || erased_[vertex_i])
+            throw std::out_of_range{std::format("no vertex with index {}", vertex_i)};
+    }
+
+    static constexpr bool flat = std::same_as<Adjacency, flat_adjacency>;
+
+    // edges of a vertex in flat mode: weights[k] is the weight of the edge to or from heads[k]
+    struct Flat_Row final
+    {
+        std::vector<size_type> heads; // sorted
+        std::vector<weight_type> weights;
+    };
+
+    // outgoing edges of a vertex keyed by their heads or incoming ones keyed by their tails
+    using row_type = std::conditional_t<flat, Flat_Row,
+                                        std::unordered_map<size_type, weight_type>>;
+
+    static auto heads(const row_type &row)
+    {
+        if constexpr (flat)
+            return std::span<const size_type>{row.heads};
+        else
+            return std::views::keys(row);
+    }
+
+    static auto entries(const row_type &row)
+    {
+        if constexpr (flat)
+            return std::views::iota(size_type{0}, row.heads.size()) |
+                   std::views::transform([&row](size_type k)
+                   {
+                       return std::pair<size_type, const weight_type &>{row.heads[k],
+                                                                        row.weights[k]};
+                   });
+        else
+            return row | std::views::transform([](const auto &edge)
+                   {
+                       return std::pair<size_type, const weight_type &>{edge.first, edge.second};
+                   });
+    }
+
+    // returns true if there was no entry of i
+    static bool insert_entry(row_type &row, size_type i, weight_type w)
+    {
+        if constexpr (flat)
+        {
+            auto it = std::ranges::lower_bound(row.heads, i);
+            if (it != row.heads.end() && *it == i)
+                return false;
+            row.weights.insert(std::next(row.weights.begin(), it - row.heads.begin()), w);
+            row.heads.insert(it, i);
+            return true;
+        }
+        else
+            return row.emplace(i, w).second;
+    }
+
+    // returns true if there was an entry of i
+    static bool erase_entry(row_type &row, size_type i)
+    {
+        if constexpr (flat)
+        {
+            auto it = std::ranges::lower_bound(row.heads, i);
+            if (it == row.heads.end() || *it != i)
+                return false;
+            row.weights.erase(std::next(row.weights.begin(), it - row.heads.begin()));
+            row.heads.erase(it);
+            return true;
+        }
+        else
+            return row.erase(i);
+    }
+
+    // the weight in the entry of i or nullptr if there is no such entry; Row is either row_type
+    // or const row_type
+    template<typename Row>
+    static auto find_entry(Row &row, size_type i)
+        -> std::conditional_t<std::is_const_v<Row>, const weight_type, weight_type> *
+    {
+        if constexpr (flat)
+        {
+            auto it = std::ranges::lower_bound(row.heads, i);
+            if (it != row.heads.end() && *it == i)
+                return &row.weights[it - row.heads.begin()];
+        }
+        else
+        {
+            if (auto it = row.find(i); it != row.end())
+                return &it->second;
+        }
+
+        return nullptr;
+    }
+
+    // the weight of the edge stored in the row of from_i; Self is either Directed_Graph or
+    // const Directed_Graph
+    template<typename Self>
+    static auto &edge_weight(Self &self, size_type from_i, size_type to_i)
+    {
+        if (auto w = find_entry(self.adjacency_list_.at(from_i), to_i))
+            return *w;
+
+        throw std::out_of_range{std::format("no edge from vertex {} to vertex {}", from_i, to_i)};
+    }
 
-    std::unordered_map<std::pair<size_type, size_type>,
-                       weight_type,
-                       boost::hash<std::pair<size_type, size_type>>> weights_;
+    // renumbering preserves the order of vertices, so sorted rows stay sorted
+    static row_type renumbered(row_type &&row,
+                               const std::vector<std::optional<size_type>> &new_indices)
+    {
+        if constexpr (flat)
+        {
+            for (auto &i : row.heads)
+                i = *new_indices[i];
+            return std::move(row);
+        }
+        else
+        {
+            row_type result;
+            result.reserve(row.size());
+            for (auto &[i, w] : row)
+                result.emplace(*new_indices[i], w);
+            return result;
+        }
+    }
+
+    vertex_cont vertices_;
+    std::vector<row_type> adjacency_list_;
+    std::vector<row_type> incoming_; // edges entering each vertex keyed by their tails
+    std::vector<bool> erased_; // tombstones
 };
 
 template<std::input_iterator It> Directed_Graph(It first, It last)
     -> Directed_Graph<typename std::iterator_traits<It>::value_type>;
 
-template<typename T>
-struct graph_traits<Directed_Graph<T>>
+template<typename T, typename W, typename Adjacency>
+struct graph_traits<Directed_Graph<T, W, Adjacency>>
 {
+private:
+
+    using G = Directed_Graph<T, W, Adjacency>;
+
+public:
+
     using vertex_type = T;
-    using size_type = typename Directed_Graph<T>::size_type;
-    using weight_type = typename Directed_Graph<T>::weight_type;
+    using size_type = typename G::size_type;
+    using weight_type = typename G::weight_type;
 
     static constexpr bool is_directed = true;
 
-    static size_type n_edges(const Directed_Graph<T> &g) { return g.n_edges(); }
-    static size_type n_vertices(const Directed_Graph<T> &g) { return g.n_vertices(); }
+    static size_type n_edges(const G &g) { return g.n_edges(); }
+    static size_type n_vertices(const G &g) { return g.n_vertices(); }
 
-    static auto adjacent_vertices(const Directed_Graph<T> &g, size_type vertex_i)
+    static auto adjacent_vertices(const G &g, size_type vertex_i)
     {
         return g.adjacent_vertices(vertex_i);
     }
 
-    static const weight_type &weight(const Directed_Graph<T> &g, size_type from, size_type to)
+    static auto adjacent_edges(const G &g, size_type vertex_i)
+    {
+        return g.adjacent_edges(vertex_i);
+    }
+
+    static auto incoming_vertices(const G &g, size_type vertex_i)
+    {
+        return g.incoming_vertices(vertex_i);
+    }
+
+    static auto incoming_edges(const G &g, size_type vertex_i)
+    {
+        return g.incoming_edges(vertex_i);
+    }
+
+    static const weight_type &weight(const G &g, size_type from, size_type to)
     {
         return g.weight(from, to);
     }
@@ -6,7 +6,6 @@
 #include <initializer_list>
 #include <tuple>
 #include <unordered_map>
-#include <unordered_set>
 #include <utility>
 #include <algorithm>
 #include <ostream>
@@ -22,10 +21,13 @@
 #include <format>
 #include <type_traits>
 #include <string>
-
-#include <boost/container_hash/hash.hpp>
+#include <cstdint>
+#include <concepts>
+#include <limits>
 
 #include "utils/graph_traits.hpp"
+#include "utils/edge_dedup.hpp"
+#include "utils/edge_map.hpp"
 
 namespace graphs
 {
@@ -80,15 +82,28 @@ concept unweighted_edge_initializer_iterator =
     unweighted_edge_initializer<typename std::iterator_traits<It>::value_type>;
 
 // Graph representation like in TAOCP 7.2.1.6
-template<std::equality_comparable V, typename E>
+//
+// Nodes are stored as a structure of arrays: vertex nodes [0, n_vertices()) have a payload and
+// links to the first and the last incident edge node; edge nodes [0, 2 * n_edges()) have a tip,
+// links to the next and the previous edge node incident on the same tip and (for weighted graphs)
+// a payload. Edge nodes 2k and 2k + 1 represent the same edge, so the mate of an edge node is
+// found without storing it until the graph is frozen (see freeze()). Links are stored as values
+// of type I, so choosing a narrow type like std::uint32_t makes the graph more than twice smaller
+// for small payloads; the number of vertices and the number of edge nodes must be less than the
+// maximal value of I. Duplicate edges are removed during construction by means of packed 64-bit
+// keys of edges, so there must be fewer than 2^32 vertices.
+template<std::equality_comparable V, typename E, std::unsigned_integral I = std::size_t>
 class KGraph final
 {
 public:
 
     using vertex_type = V;
     using edge_type = E;
+    using index_type = I;
     using size_type = std::size_t;
 
+    KGraph() = default;
+
     template<typename It>
     requires std::forward_iterator<It> &&
              edge_initializer<typename std::iterator_traits<It>::value_type>
@@ -101,13 +116,29 @@ public:
         fill_incident_edges_lists();
     }
 
+    // Duplicate edges are removed by sorting packed keys of edges on several threads instead of
+    // inserting edges in a hash table; it's the preferable way of constructing large graphs.
+    // Edge values must be totally ordered since opts may ask to keep the least of them.
+    template<typename It>
+    requires std::forward_iterator<It> &&
+             edge_initializer<typename std::iterator_traits<It>::value_type> &&
+             (std::is_void_v<E> || std::totally_ordered<E>)
+    KGraph(It first, It last, sorted_dedup opts)
+    {
+        if (first == last)
+            return;
+
+        fill_payload_index_and_tip(first, last, opts);
+        fill_incident_edges_lists();
+    }
+
     template<edge_initializer T>
     KGraph(std::initializer_list<T> ilist) : KGraph(ilist.begin(), ilist.end()) {}
 
-    size_type n_vertices() const noexcept { return n_vertices_; }
-    size_type n_edges() const noexcept { return (data_.size() - n_vertices()) / 2; }
+    size_type n_vertices() const noexcept { return vertices_.size(); }
+    size_type n_edges() const noexcept { return n_edges_; }
 
-    bool empty() const noexcept { return n_vertices_ == 0; }
+    bool empty() const noexcept { return n_vertices() == 0; }
 
     static consteval bool weighted() { return !std::is_same_v<std::remove_cv_t<E>, void>; }
 
@@ -123,24 +154,26 @@ public:
     auto ae_end(size_type i) const;
     auto ae_cend(size_type i) const { return ae_end(i); }
 
+    // The table is numbered like in TAOCP: vertex nodes are followed by edge nodes, and a link to
+    // the vertex node is dumped instead of nil.
     void dump_as_table(std::ostream &os) const
     {
-        auto nothing_dumper = []([[maybe_unused]] const KNode &node){ return 'X'; };
-        auto vertex_dumper = [](const KNode &node) -> const V & { return node.get_vertex(); };
+        auto nothing_dumper = []([[maybe_unused]] size_type i){ return 'X'; };
+        auto vertex_dumper = [this](size_type v) -> const V & { return vertices_[v]; };
 
         dump_header(os);
         dump_separator(os);
         if constexpr (weighted())
-            dump_line(os, vertex_dumper,
-                          [](const KNode &node) -> const E & { return node.get_edge(); });
+            dump_line(os, vertex_dumper, [this](size_type e) -> const E & { return weight(e); });
         else
             dump_line(os, vertex_dumper, nothing_dumper);
         dump_separator(os);
-        dump_line(os, &KNode::i, &KNode::i, 'i');
-        dump_line(os, nothing_dumper,
-                      [](const KNode &node){ return *node.tip; }, 't');
-        dump_line(os, &KNode::next, &KNode::next, 'n');
-        dump_line(os, &KNode::prev, &KNode::prev, 'p');
+        dump_line(os, std::identity{}, [this](size_type e){ return n_vertices() + e; }, 'i');
+        dump_line(os, nothing_dumper, [this](size_type e){ return tip_[e]; }, 't');
+        dump_line(os, [this](size_type v){ return table_link(first_[v], v); },
+                      [this](size_type e){ return table_link(next_[e], tip_[e]); }, 'n');
+        dump_line(os, [this](size_type v){ return table_link(last_[v], v); },
+                      [this](size_type e){ return table_link(prev_[e], tip_[e]); }, 'p');
     }
 
     void dump_as_dot(std::ostream &os) const
@@ -149,30 +182,57 @@ public:
               "{\n";
 
         for (auto v : std::views::iota(0uz, n_vertices()))
-            std::println(os, "    node_{} [label = \"{}\"];", v, data_[v].get_vertex());
+            std::println(os, "    node_{} [label = \"{}\"];", v, vertices_[v]);
 
         os << '\n';
 
-        for (auto e = n_vertices(); e != data_.size(); e += 2)
+        for (auto e : std::views::iota(0uz, tip_.size()))
         {
+            if (tip_[e] == nil || mate(e) < e)
+                continue;
+
             if constexpr (weighted())
                 std::println(os, "    node_{} -- node_{} [label = \"{}\"]",
-                             *data_[e].tip, *data_[e + 1].tip, weight(e));
+                             tip_[e], tip_[mate(e)], weight(e));
             else
-                std::println(os, "    node_{} -- node_{}", *data_[e].tip, *data_[e + 1].tip);
+                std::println(os, "    node_{} -- node_{}", tip_[e], tip_[mate(e)]);
         }
 
         os << "}\n";
     }
 
+    // O(1) on average with the vertex index, O(V) otherwise
     std::optional<size_type> find_vertex(const V &v) const
     {
-        auto vertices = std::views::take(data_, n_vertices());
-        auto it = std::ranges::find(vertices, v,
-            [](const KNode &node) -> const V & { return node.get_vertex(); });
-        if (it == vertices.end())
+        if (use_vertex_index_)
+        {
+            build_vertex_index();
+
+            if (auto it = vertex_index_->find(v); it != vertex_index_->end())
+                return std::optional{it->second};
             return std::nullopt;
-        return std::optional{it - vertices.begin()};
+        }
+
+        auto it = std::ranges::find(vertices_, v);
+        if (it == vertices_.end())
+            return std::nullopt;
+        return std::optional<size_type>{it - vertices_.begin()};
+    }
+
+    // Resolves every value of the range; the i-th element of the result is the index of the
+    // vertex equal to the i-th element of the range or std::nullopt if there is no such vertex
+    template<std::ranges::input_range R>
+    requires std::convertible_to<std::ranges::range_reference_t<R>, const V &>
+    std::vector<std::optional<size_type>> find_vertices(R &&values) const
+    {
+        std::vector<std::optional<size_type>> indices;
+        if constexpr (std::ranges::sized_range<R>)
+            indices.reserve(std::ranges::size(values));
+
+        for (const V &v : values)
+            indices.push_back(find_vertex(v));
+
+        return indices;
     }
 
     auto adjacent_vertices(size_type v) const
@@ -180,128 +240,516 @@ public:
         return std::ranges::subrange{av_begin(v), av_end(v)};
     }
 
+    // returns a range of pairs (index of adjacent vertex, weight of the edge); unlike calling
+    // weight(from, to) for every adjacent vertex, it doesn't walk the list of incident edges again
+    auto adjacent_edges(size_type v) const requires (weighted())
+    {
+        return std::ranges::subrange{ae_begin(v), ae_end(v)} |
+               std::views::transform([this](size_type e)
+               {
+                   return std::pair<size_type, const E &>{tip_[mate(e)], weight(e)};
+               });
+    }
+
     // use auto& here because of the possibility for E to be (possibly cv-qualified) void and
     // because such type cannot be referenced.
-    auto &weight(size_type e) const { return data_[e].get_edge(); }
+    auto &weight(size_type e) const { return edges_[e]; }
+    // O(log(deg)) with the edge index, O(deg) otherwise
     auto &weight(size_type from, size_type to) const
+    {
+        auto e = find_edge(from, to);
+        if (!e.has_value())
+            throw std::runtime_error{
+                std::format("no edge incident on vertices with indices {} and {}", from, to)};
+        return weight(*e);
+    }
+
+    // O(log(deg)) with the edge index, O(deg) otherwise
+    bool are_adjacent(size_type from, size_type to) const
+    {
+        return find_edge(from, to).has_value();
+    }
+
+    // The edge index consists of sorted arrays of neighbours of every vertex. When it's enabled,
+    // weight(from, to) and are_adjacent() use binary search instead of walking the list of edges
+    // incident on "from". The index is built on first use and then kept up to date by modifiers
+    // at the cost of O(deg) per edge; since building it modifies the graph, call
+    // build_edge_index() explicitly before sharing the graph between threads.
+    void enable_edge_index(bool enable = true)
+    {
+        use_edge_index_ = enable;
+        if (!enable)
+            edge_index_.reset();
+    }
+
+    bool edge_index_enabled() const noexcept { return use_edge_index_; }
+
+    // The vertex index is a hash table from vertices to their indices. When it's enabled,
+    // find_vertex() and insert_vertex() don't scan all vertices. Like the edge index, it's built
+    // on first use, so call build_vertex_index() explicitly before sharing the graph between
+    // threads. Graphs used by indices only don't pay for the table.
+    void enable_vertex_index(bool enable = true)
+    {
+        use_vertex_index_ = enable;
+        if (!enable)
+            vertex_index_.reset();
+    }
+
+    bool vertex_index_enabled() const noexcept { return use_vertex_index_; }
+
+    // Renumbers edge nodes so that the nodes incident on every vertex are stored contiguously in
+    // the order of the list of incident edges. After that, iterating over adjacent vertices or
+    // edges reads the arrays of edge nodes sequentially. Since mates of edge nodes are no longer
+    // neighbours, they are stored explicitly, which costs one more index per edge node.
+    // Invalidates indices of edge nodes and the edge index.
+    // O(V + E)
+    void freeze()
+    {
+        if (frozen_)
+            return;
+
+        const size_type n_nodes = 2 * n_edges(); // edge nodes in the free list are dropped
+
+        std::vector<I> order; // order[i] is the old index of the edge node that becomes i
+        order.reserve(n_nodes);
+        for (auto v : std::views::iota(0uz, n_vertices()))
+            for (auto e = first_[v]; e != nil; e = next_[e])
+                order.push_back(e);
+
+        assert(order.size() == n_nodes);
+
+        std::vector<I> position(tip_.size()); // inverse of order
+        for (auto i : std::views::iota(0uz, n_nodes))
+            position[order[i]] = static_cast<I>(i);
+
+        std::vector<I> tip(n_nodes);
+        std::vector<I> mate(n_nodes);
+        for (auto i : std::views::iota(0uz, n_nodes))
+        {
+            tip[i] = tip_[order[i]];
+            mate[i] = position[this->mate(order[i])];
+        }
+
+        if constexpr (weighted())
+        {
+            std::vector<E> edges;
+            edges.reserve(n_nodes);
+            for (auto e : order)
+                edges.push_back(std::move(edges_[e]));
+            edges_ = std::move(edges);
+        }
+
+        tip_ = std::move(tip);
+        mate_ = std::move(mate);
+        next_.resize(n_nodes);
+        prev_.resize(n_nodes);
+        free_ = nil;
+
+        // every list occupies a block of consecutive edge nodes now
+
+        for (auto i : std::views::iota(0uz, n_nodes))
+        {
+            const bool first = (i == 0 || tip_[i - 1] != tip_[i]);
+            const bool last = (i + 1 == n_nodes || tip_[i + 1] != tip_[i]);
+
+            prev_[i] = first ? nil : static_cast<I>(i - 1);
+            next_[i] = last ? nil : static_cast<I>(i + 1);
+
+            if (first)
+                first_[tip_[i]] = static_cast<I>(i);
+            if (last)
+                last_[tip_[i]] = static_cast<I>(i);
+        }
+
+        edge_index_.reset();
+        frozen_ = true;
+    }
+
+    // true if edge nodes incident on every vertex are stored contiguously
+    bool frozen() const noexcept { return frozen_; }
+
+    // Modifiers. Edge nodes are spliced into and out of lists of incident edges in O(1); pairs of
+    // edge nodes of erased edges are kept in a free list and reused by insert_edge(). The edge
+    // index, if it's built, is updated in O(deg(from) + deg(to)) rather than rebuilt. Any
+    // modification invalidates iterators of lists it changes; erase_edge() invalidates the index
+    // of the erased edge node and of its mate.
+
+    // Returns index of the vertex equal to v; inserts such vertex if there isn't one.
+    // O(1) on average with the vertex index, O(V) otherwise
+    size_type insert_vertex(const V &v)
+    {
+        if (auto i = find_vertex(v); i.has_value())
+            return *i;
+
+        const size_type i = n_vertices();
+        if (i == nil)
+            throw std::length_error{"too many vertices for the index type"};
+
+        vertices_.push_back(v);
+        first_.push_back(nil);
+        last_.push_back(nil);
+        if (edge_index_.has_value())
+            edge_index_->rows.emplace_back();
+
+        if (vertex_index_.has_value())
+            vertex_index_->emplace(v, i);
+
+        return i;
+    }
+
+    // Returns index of the edge node incident on "from" that represents the edge between "from"
+    // and "to". If the vertices are already adjacent, the graph isn't changed.
+    // O(1) plus the cost of are_adjacent(from, to) and of updating the edge index
+    template<typename... Args>
+    requires (sizeof...(Args) == (weighted() ? 1 : 0))
+    size_type insert_edge(size_type from, size_type to, Args &&... payload)
+    {
+        if (auto e = find_edge(from, to); e.has_value())
+            return *e;
+
+        size_type e;
+        if (free_ != nil)
+        {
+            e = std::exchange(free_, next_[free_]);
+            tip_[e] = static_cast<I>(from);
+            tip_[mate(e)] = static_cast<I>(to);
+            if constexpr (weighted())
+            {
+                edges_[e] = E(payload...);
+                edges_[mate(e)] = E(std::forward<Args>(payload)...);
+            }
+            ++n_edges_;
+        }
+        else
+        {
+            e = tip_.size();
+            push_edge(from, to, std::forward<Args>(payload)...);
+            next_.resize(tip_.size(), nil);
+            prev_.resize(tip_.size(), nil);
+            if (!mate_.empty())
+            {
+                mate_.push_back(static_cast<I>(e + 1));
+                mate_.push_back(static_cast<I>(e));
+            }
+        }
+
+        link(e);
+        link(mate(e));
+
+        if (edge_index_.has_value())
+        {
+            index_insert(from, to, e);
+            index_insert(to, from, mate(e));
+        }
+        frozen_ = false;
+
+        return e;
+    }
+
+    // O(1) plus the cost of updating the edge index
+    void erase_edge(size_type e)
+    {
+        if (e >= tip_.size() || tip_[e] == nil)
+            throw std::out_of_range{std::format("no edge node with index {}", e)};
+
+        unlink(e);
+        unlink(mate(e));
+
+        if (edge_index_.has_value())
+        {
+            index_erase(tip_[e], tip_[mate(e)], e);
+            index_erase(tip_[mate(e)], tip_[e], mate(e));
+        }
+
+        tip_[e] = tip_[mate(e)] = nil;
+        next_[e] = std::exchange(free_, static_cast<I>(e));
+        --n_edges_;
+
+        frozen_ = false;
+    }
+
+    // Does nothing if the vertices aren't adjacent. O(1) plus the cost of are_adjacent(from, to)
+    // and of updating the edge index
+    void erase_edge(size_type from, size_type to)
+    {
+        if (auto e = find_edge(from, to); e.has_value())
+            erase_edge(*e);
+    }
+
+    // O(V + E * log(E / V))
+    void build_edge_index() const
+    {
+        if (edge_index_.has_value())
+            return;
+
+        Edge_Index index;
+        index.rows.resize(n_vertices());
+
+        for (auto v : std::views::iota(0uz, n_vertices()))
+        {
+            auto &row = index.rows[v];
+            for (auto it = ae_begin(v), end = ae_end(v); it != end; ++it)
+                row.emplace_back(tip_[mate(*it)], *it);
+            std::ranges::sort(row);
+        }
+
+        edge_index_ = std::move(index);
+    }
+
+    // O(V)
+    void build_vertex_index() const
+    {
+        if (vertex_index_.has_value())
+            return;
+
+        std::unordered_map<V, size_type> index;
+        index.reserve(n_vertices());
+        for (auto v : std::views::iota(0uz, n_vertices()))
+            index.emplace(vertices_[v], v);
+
+        vertex_index_ = std::move(index);
+    }
+
+private:
+
+    static constexpr I nil = std::numeric_limits<I>::max();
+
+    // returns index of the edge node of "from" that corresponds to the edge incident on "from"
+    // and "to" if there is one
+    std::optional<size_type> find_edge(size_type from, size_type to) const
     {
         if (from >= n_vertices())
             throw std::out_of_range{std::format("no vertex with index {}", from)};
         if (to >= n_vertices())
             throw std::out_of_range{std::format("no vertex with index {}", to)};
 
+        if (use_edge_index_)
+        {
+            build_edge_index();
+
+            auto &row = edge_index_->rows[from];
+            auto it = std::ranges::lower_bound(row, static_cast<I>(to), std::less{},
+                                               &std::pair<I, I>::first);
+            if (it == row.end() || it->first != to)
+                return std::nullopt;
+            return std::optional<size_type>{it->second};
+        }
+
         auto end = ae_end(from);
         auto it = std::find_if(ae_begin(from), end,
-                               [this, to](size_type edge){ return *data_[mate(edge)].tip == to; });
+                               [this, to](size_type edge){ return tip_[mate(edge)] == to; });
         if (it == end)
-            throw std::runtime_error{
-                std::format("no edge incident on vertices with indices {} and {}", from, to)};
-        return weight(*it);
+            return std::nullopt;
+        return std::optional{*it};
     }
 
-private:
+    // edge node e incident on v leads to u
+    void index_insert(size_type v, size_type u, size_type e)
+    {
+        auto &row = edge_index_->rows[v];
+        const std::pair entry{static_cast<I>(u), static_cast<I>(e)};
+        row.insert(std::ranges::lower_bound(row, entry), entry);
+    }
+
+    void index_erase(size_type v, size_type u, size_type e)
+    {
+        auto &row = edge_index_->rows[v];
+        row.erase(std::ranges::lower_bound(row, std::pair{static_cast<I>(u), static_cast<I>(e)}));
+    }
 
     static constexpr std::size_t kwidth = 8;
     static_assert(kwidth % 2 == 0, "width parameter of the stream should be an even number");
 
-    // to be used in constructor only
+    size_type insert_unique_vertex(std::unordered_map<V, size_type> &unique_vertices, const V &v)
+    {
+        if (auto it = unique_vertices.find(v); it == unique_vertices.end())
+        {
+            size_type i = vertices_.size();
+            if (i == nil)
+                throw std::length_error{"too many vertices for the index type"};
+
+            unique_vertices.emplace(v, i);
+            vertices_.push_back(v);
+            return i;
+        }
+        else
+            return it->second;
+    }
+
+    template<typename... Args>
+    void push_edge(size_type i_1, size_type i_2, Args &&... payload)
+    {
+        if (tip_.size() + 2 > nil)
+            throw std::length_error{"too many edges for the index type"};
+
+        tip_.push_back(static_cast<I>(i_1));
+        tip_.push_back(static_cast<I>(i_2));
+        ++n_edges_;
+
+        if constexpr (weighted())
+        {
+            static_assert(sizeof...(Args) == 1);
+            edges_.push_back(payload...);
+            edges_.push_back(std::forward<Args>(payload)...);
+        }
+    }
+
     template<std::forward_iterator It>
     void fill_payload_index_and_tip(It first, It last)
     {
-        assert(data_.empty());
-        assert(n_vertices_ == 0);
+        assert(vertices_.empty());
+        assert(tip_.empty());
 
-        std::unordered_map<V, size_type> unique_vertices(std::distance(first, last) * 2);
-        auto insert_unique_vertex = [&](const V &v)
-        {
-            if (auto it = unique_vertices.find(v); it == unique_vertices.end())
-            {
-                size_type i = data_.size();
-                unique_vertices.emplace(v, i);
-                data_.emplace_back(v, i);
-                return i;
-            }
-            else
-                return it->second;
-        };
+        const auto n_edges = static_cast<size_type>(std::distance(first, last));
 
-        using edge_type = std::pair<size_type, size_type>;
-        using edges_set = std::unordered_set<edge_type, boost::hash<edge_type>>;
-        using edges_map = std::unordered_map<edge_type, E, boost::hash<edge_type>>;
+        std::unordered_map<V, size_type> unique_vertices(n_edges * 2);
 
-        std::conditional_t<weighted(), edges_map, edges_set> unique_edges;
+        // edges are pushed in order of their first occurrence
+        Edge_Map<std::monostate> unique_edges;
+        unique_edges.reserve(n_edges);
+        reserve_edges(n_edges);
 
         // we don't use structured binding here because in instantiation of structured binding
         // function get() is looked up only via ADL, and in case decltype(*first) is not in
         // namespace std, such function won't be found.
         for (; first != last; ++first)
         {
-            size_type i_1 = insert_unique_vertex(std::get<0>(*first));
-            size_type i_2 = insert_unique_vertex(std::get<1>(*first));
+            size_type i_1 = insert_unique_vertex(unique_vertices, std::get<0>(*first));
+            size_type i_2 = insert_unique_vertex(unique_vertices, std::get<1>(*first));
 
             if (i_1 > i_2)
                 std::swap(i_1, i_2);
 
+            if (!unique_edges.emplace(std::pair{i_1, i_2}, std::monostate{}))
+                continue;
+
             if constexpr (weighted())
-                unique_edges.emplace(std::pair{i_1, i_2}, std::get<2>(*first));
+                push_edge(i_1, i_2, std::get<2>(*first));
             else
-                unique_edges.emplace(std::pair{i_1, i_2});
+                push_edge(i_1, i_2);
         }
+    }
 
-        n_vertices_ = data_.size();
+    template<std::forward_iterator It>
+    void fill_payload_index_and_tip(It first, It last, sorted_dedup opts)
+    {
+        assert(vertices_.empty());
+        assert(tip_.empty());
+
+        const auto n_edges = static_cast<size_type>(std::distance(first, last));
+
+        std::unordered_map<V, size_type> unique_vertices(n_edges * 2);
+
+        std::vector<std::uint64_t> keys;
+        keys.reserve(n_edges);
 
+        std::conditional_t<weighted(), std::vector<E>, std::monostate> weights;
         if constexpr (weighted())
+            weights.reserve(n_edges);
+
+        for (; first != last; ++first)
         {
-            for (auto &[edge, e] : unique_edges)
-            {
-                data_.emplace_back(e, data_.size(), edge.first);
-                data_.emplace_back(std::move(e), data_.size(), edge.second);
-            }
+            size_type i_1 = insert_unique_vertex(unique_vertices, std::get<0>(*first));
+            size_type i_2 = insert_unique_vertex(unique_vertices, std::get<1>(*first));
+
+            keys.push_back(pack_edge(std::min(i_1, i_2), std::max(i_1, i_2)));
+            if constexpr (weighted())
+                weights.push_back(std::get<2>(*first));
         }
-        else
+
+        auto weight_less = [&weights](size_type i, size_type j)
         {
-            for (auto &edge : unique_edges)
-            {
-                data_.emplace_back(std::nullopt, data_.size(), edge.first);
-                data_.emplace_back(std::nullopt, data_.size(), edge.second);
-            }
+            if constexpr (weighted())
+                return weights[i] < weights[j];
+            else
+                return false;
+        };
+
+        auto kept = dedup_edges(std::move(keys), opts, weight_less);
+
+        reserve_edges(kept.size());
+
+        for (auto [key, i] : kept)
+        {
+            auto [i_1, i_2] = unpack_edge(key);
+
+            if constexpr (weighted())
+                push_edge(i_1, i_2, std::move(weights[i]));
+            else
+                push_edge(i_1, i_2);
         }
     }
 
-    void fill_incident_edges_lists()
+    void reserve_edges(size_type n_edges)
     {
-        auto first_edge_it = std::next(data_.begin(), n_vertices());
-        for (auto v : std::views::iota(0uz, n_vertices()))
-        {
-            auto it = std::ranges::find(first_edge_it, data_.end(), v, &KNode::tip);
+        tip_.reserve(n_edges * 2);
+        if constexpr (weighted())
+            edges_.reserve(n_edges * 2);
+    }
 
-            assert(it != data_.end());
-            assert(it->tip.has_value());
+    // O(V + E): every edge node is appended to the end of the list of its tip, so the lists are
+    // ordered by indices of edge nodes
+    void fill_incident_edges_lists()
+    {
+        first_.assign(n_vertices(), nil);
+        last_.assign(n_vertices(), nil);
+        next_.assign(tip_.size(), nil);
+        prev_.assign(tip_.size(), nil);
 
-            data_[v].next = it->i;
-            it->prev = v;
+        for (auto e : std::views::iota(0uz, tip_.size()))
+        {
+            const I v = tip_[e];
 
-            while (true)
+            if (last_[v] == nil)
+                first_[v] = static_cast<I>(e);
+            else
             {
-                auto next_it = std::ranges::find(std::next(it), data_.end(), v, &KNode::tip);
-                if (next_it == data_.end())
-                    break;
-
-                assert(next_it->tip.has_value());
-                it->next = next_it->i;
-                next_it->prev = it->i;
-                it = next_it;
+                next_[last_[v]] = static_cast<I>(e);
+                prev_[e] = last_[v];
             }
 
-            data_[v].prev = it->i;
-            it->next = v;
+            last_[v] = static_cast<I>(e);
         }
     }
 
+    // appends edge node e to the end of the list of its tip
+    void link(size_type e)
+    {
+        const I v = tip_[e];
+
+        next_[e] = nil;
+        prev_[e] = last_[v];
+        if (last_[v] == nil)
+            first_[v] = static_cast<I>(e);
+        else
+            next_[last_[v]] = static_cast<I>(e);
+        last_[v] = static_cast<I>(e);
+    }
+
+    void unlink(size_type e)
+    {
+        const I v = tip_[e];
+
+        if (prev_[e] == nil)
+            first_[v] = next_[e];
+        else
+            next_[prev_[e]] = next_[e];
+
+        if (next_[e] == nil)
+            last_[v] = prev_[e];
+        else
+            prev_[next_[e]] = prev_[e];
+    }
+
+    size_type table_link(I link, size_type head) const
+    {
+        return link == nil ? head : n_vertices() + link;
+    }
+
     void dump_header(std::ostream &os) const
     {
-        std::string vertices_spaces(n_vertices() * kwidth / 2 - 4, ' ');
-        std::string edges_spaces(n_edges() * kwidth - 3, ' ');
+        std::string vertices_spaces(std::max(n_vertices() * kwidth / 2, 4uz) - 4, ' ');
+        std::string edges_spaces(std::max(n_edges() * kwidth, 3uz) - 3, ' ');
 
         os << "    |" << vertices_spaces  << "vertices" << vertices_spaces << '|'
            << edges_spaces << "edges" << edges_spaces << " |" << std::endl;
@@ -317,57 +765,51 @@ private:
     void dump_line(std::ostream &os, VDumper vd, EDumper ed, char line_name = ' ') const
     {
         os << "   " << line_name << '|';
-        for (const auto &node : std::views::take(data_, n_vertices()))
-            os << std::setw(kwidth) << std::invoke(vd, node);
+        for (auto v : std::views::iota(0uz, n_vertices()))
+            os << std::setw(kwidth) << std::invoke(vd, v);
         os << '|';
-        for (const auto &node : std::views::drop(data_, n_vertices()))
-            os << std::setw(kwidth) << std::invoke(ed, node);
+        for (auto e : std::views::iota(0uz, tip_.size()))
+        {
+            if (tip_[e] != nil) // edge nodes in the free list aren't dumped
+                os << std::setw(kwidth) << std::invoke(ed, e);
+        }
         os << '|' << std::endl;
     }
 
-    size_type mate(size_type i) const
+    size_type mate(size_type e) const noexcept
     {
-        assert(i >= n_vertices_);
-        return ((i - n_vertices_) ^ size_type{1}) + n_vertices_;
+        return mate_.empty() ? e ^ size_type{1} : mate_[e];
     }
 
-    struct KNode final
+    // vertex nodes
+    std::vector<V> vertices_;
+    std::vector<I> first_; // the first incident edge node or nil
+    std::vector<I> last_;  // the last incident edge node or nil
+
+    // edge nodes
+    std::vector<I> tip_;
+    std::vector<I> next_; // the next edge node incident on the same tip or nil
+    std::vector<I> prev_; // the previous edge node incident on the same tip or nil
+    [[no_unique_address]]
+    std::conditional_t<weighted(), std::vector<E>, std::monostate> edges_;
+    std::vector<I> mate_; // empty if the mate of edge node e is e ^ 1
+    size_type n_edges_ = 0;
+    I free_ = nil; // the first node of the free list chained through next_
+    bool frozen_ = false;
+
+    mutable std::optional<std::unordered_map<V, size_type>> vertex_index_;
+    bool use_vertex_index_ = false;
+
+    struct Edge_Index final
     {
-        template<typename Self>
-        auto &&get_vertex(this Self &&self)
-        {
-            if constexpr (std::is_same_v<V, E>)
-                return self.payload;
-            else if constexpr (weighted())
-                return std::get<V>(self.payload);
-            else
-                return *self.payload;
-        }
-
-        template<typename Self>
-        auto &&get_edge(this Self &&self) // is not instantiated for unweighted graphs
-        {
-            if constexpr (std::is_same_v<V, E>)
-                return self.payload;
-            else if constexpr (weighted())
-                return std::get<E>(self.payload);
-        }
-
-        using payload_type =
-        std::conditional_t<std::is_same_v<V, E>, V,
-                           std::conditional_t<weighted(), std::variant<V, E>, std::optional<V>>>;
-
-        payload_type payload;
-        size_type i;
-        std::optional<size_type> tip;
-        size_type next;
-        size_type prev;
+        // rows[v] holds sorted pairs (neighbour, edge node) of edge nodes incident on vertex v
+        std::vector<std::vector<std::pair<I, I>>> rows;
     };
 
-    std::vector<KNode> data_;
-    size_type n_vertices_ = 0;
+    mutable std::optional<Edge_Index> edge_index_;
+    bool use_edge_index_ = false;
 
-    template<typename v, typename e, bool type>
+    template<typename v, typename e, typename i, bool type>
     friend class AdjacentPartIterator;
 };
 
@@ -378,39 +820,50 @@ template<weighted_edge_initializer_iterator It> KGraph(It first, It last)
 template<unweighted_edge_initializer_iterator It> KGraph(It first, It last)
     -> KGraph<std::tuple_element_t<0, typename std::iterator_traits<It>::value_type>, void>;
 
+template<weighted_edge_initializer_iterator It> KGraph(It first, It last, sorted_dedup)
+    -> KGraph<std::tuple_element_t<0, typename std::iterator_traits<It>::value_type>,
+              std::tuple_element_t<2, typename std::iterator_traits<It>::value_type>>;
+
+template<unweighted_edge_initializer_iterator It> KGraph(It first, It last, sorted_dedup)
+    -> KGraph<std::tuple_element_t<0, typename std::iterator_traits<It>::value_type>, void>;
+
 template<weighted_edge_initializer T> KGraph(std::initializer_list<T>)
     -> KGraph<std::tuple_element_t<0, T>, std::tuple_element_t<2, T>>;
 
 template<unweighted_edge_initializer T> KGraph(std::initializer_list<T>)
     -> KGraph<std::tuple_element_t<0, T>, void>;
 
-template<typename V, typename E, bool type>
+// Iterates over edge nodes incident on a vertex; the past-the-end iterator corresponds to nil.
+// Only next_ and prev_ arrays are read when the iterator is moved.
+template<typename V, typename E, typename I, bool type>
 class AdjacentPartIterator final
 {
+    using graph_type = KGraph<V, E, I>;
+
 public:
 
     using iterator_category = std::bidirectional_iterator_tag;
     using difference_type = std::ptrdiff_t;
-    using value_type = typename KGraph<V, E>::size_type;
+    using value_type = typename graph_type::size_type;
     using reference = const value_type &;
     // pointer is void since C++20
 
     AdjacentPartIterator() = default;
 
-    AdjacentPartIterator(const KGraph<V, E> &g, value_type i)
-        : g_{std::addressof(g)}, edge_index_{i} {}
+    AdjacentPartIterator(const graph_type &g, value_type v, I e)
+        : g_{std::addressof(g)}, vertex_index_{static_cast<I>(v)}, edge_index_{e} {}
 
     value_type operator*() const
     {
         if constexpr (type)
-            return *g_->data_[g_->mate(edge_index_)].tip;
+            return g_->tip_[g_->mate(edge_index_)];
         else
             return edge_index_;
     }
 
     AdjacentPartIterator &operator++() noexcept
     {
-        edge_index_ = g_->data_[edge_index_].next;
+        edge_index_ = g_->next_[edge_index_];
         return *this;
     }
 
@@ -423,7 +876,8 @@ public:
 
     AdjacentPartIterator &operator--() noexcept
     {
-        edge_index_ = g_->data_[edge_index_].prev;
+        edge_index_ = edge_index_ == graph_type::nil ? g_->last_[vertex_index_]
+                                                     : g_->prev_[edge_index_];
         return *this;
     }
 
@@ -436,48 +890,57 @@ public:
 
     bool operator==(const AdjacentPartIterator &rhs) const noexcept
     {
-        return g_ == rhs.g_ && edge_index_ == rhs.edge_index_;
+        return g_ == rhs.g_ && vertex_index_ == rhs.vertex_index_ &&
+               edge_index_ == rhs.edge_index_;
     }
 
 private:
 
-    const KGraph<V, E> *g_ = nullptr;
-    value_type edge_index_;
+    const graph_type *g_ = nullptr;
+    I vertex_index_;
+    I edge_index_;
 };
 
-template<typename V, typename E>
-using AdjacentVerticesIterator = AdjacentPartIterator<V, E, true>;
+template<typename V, typename E, typename I = std::size_t>
+using AdjacentVerticesIterator = AdjacentPartIterator<V, E, I, true>;
 
-template<typename V, typename E>
-using AdjacentEdgesIterator = AdjacentPartIterator<V, E, false>;
+template<typename V, typename E, typename I = std::size_t>
+using AdjacentEdgesIterator = AdjacentPartIterator<V, E, I, false>;
 
 static_assert(std::bidirectional_iterator<AdjacentVerticesIterator<int, int>>);
 static_assert(std::bidirectional_iterator<AdjacentEdgesIterator<int, int>>);
+static_assert(std::bidirectional_iterator<AdjacentEdgesIterator<int, int, std::uint32_t>>);
 
-template<std::equality_comparable V, typename E>
-auto KGraph<V, E>::av_begin(size_type v) const
+template<std::equality_comparable V, typename E, std::unsigned_integral I>
+auto KGraph<V, E, I>::av_begin(size_type v) const
 {
-    return AdjacentVerticesIterator<V, E>{*this, data_[v].next};
+    return AdjacentVerticesIterator<V, E, I>{*this, v, first_[v]};
 }
 
-template<std::equality_comparable V, typename E>
-auto KGraph<V, E>::av_end(size_type v) const { return AdjacentVerticesIterator<V, E>{*this, v}; }
+template<std::equality_comparable V, typename E, std::unsigned_integral I>
+auto KGraph<V, E, I>::av_end(size_type v) const
+{
+    return AdjacentVerticesIterator<V, E, I>{*this, v, nil};
+}
 
-template<std::equality_comparable V, typename E>
-auto KGraph<V, E>::ae_begin(size_type v) const
+template<std::equality_comparable V, typename E, std::unsigned_integral I>
+auto KGraph<V, E, I>::ae_begin(size_type v) const
 {
-    return AdjacentEdgesIterator<V, E>{*this, data_[v].next};
+    return AdjacentEdgesIterator<V, E, I>{*this, v, first_[v]};
 }
 
-template<std::equality_comparable V, typename E>
-auto KGraph<V, E>::ae_end(size_type v) const { return AdjacentEdgesIterator<V, E>{*this, v}; }
+template<std::equality_comparable V, typename E, std::unsigned_integral I>
+auto KGraph<V, E, I>::ae_end(size_type v) const
+{
+    return AdjacentEdgesIterator<V, E, I>{*this, v, nil};
+}
 
-template<typename V, typename E>
-struct graph_traits<KGraph<V, E>>
+template<typename V, typename E, typename I>
+struct graph_traits<KGraph<V, E, I>>
 {
 private:
 
-    using G = KGraph<V, E>;
+    using G = KGraph<V, E, I>;
 
 public:
 
@@ -491,6 +954,11 @@ public:
     static size_type n_edges(const G &g) { return g.n_edges(); }
 
     static auto adjacent_vertices(const G &g, size_type i) { return g.adjacent_vertices(i); }
+    static auto adjacent_edges(const G &g, size_type i) requires (G::weighted())
+    {
+        return g.adjacent_edges(i);
+    }
+
     static const weight_type &weight(const G &g, size_type from, size_type to)
     {
         return g.weight(from, to);
@@ -2,8 +2,10 @@
 #define INCLUDE_UTILS_DISTANCE_HPP
 
 #include <concepts>
+#include <type_traits>
 #include <exception>
 #include <compare>
+#include <limits>
 
 namespace graphs
 {
@@ -14,8 +16,18 @@ struct bad_distance_access : public std::exception
 };
 
 template<typename T>
-concept arithmetic = std::integral<T> && !std::same_as<bool, std::remove_cv_t<T>>;
+concept arithmetic =
+    (std::integral<T> && !std::same_as<bool, std::remove_cv_t<T>>) || std::floating_point<T>;
 
+// std::strong_ordering for integral types and std::partial_ordering for floating-point ones
+template<arithmetic T>
+using distance_ordering = std::compare_three_way_result_t<T>;
+
+// Infinity is encoded by the largest value of T (positive infinity for floating-point types), so
+// Distance<T> is as large as T, and comparisons are comparisons of T. The price is that the
+// largest value of an integral type can't be a finite distance. Addition saturates: the sum is
+// infinite if any of the arguments is infinite, and sums of integers that overflow are clamped to
+// the limits of T (so an overflowing sum of finite distances becomes infinite).
 template<arithmetic T>
 class Distance final
 {
@@ -23,10 +35,10 @@ public:
 
     using value_type = T;
 
-    Distance() noexcept : is_inf_{true} {}
-    Distance(T w) noexcept : w_{w}, is_inf_{false} {} // we want implicit conversion
+    Distance() noexcept : w_{inf_value} {}
+    Distance(T w) noexcept : w_{w} {} // we want implicit conversion
 
-    bool is_inf() const noexcept { return is_inf_; }
+    bool is_inf() const noexcept { return w_ == inf_value; }
     T operator*() const noexcept { return w_; } // using if is_inf() == true is UB
     T value() const
     {
@@ -37,25 +49,45 @@ public:
 
     static Distance inf() noexcept { return Distance{}; }
 
+    // the sum of the finite distance w and d with saturation
+    static Distance add(T w, T d) noexcept
+    {
+        if constexpr (std::floating_point<T>)
+            return w + d;
+        else
+        {
+            constexpr T max = std::numeric_limits<T>::max();
+            constexpr T min = std::numeric_limits<T>::min();
+
+            if (d > 0 && w > max - d)
+                return max;
+            if constexpr (std::is_signed_v<T>)
+            {
+                if (d < 0 && w < min - d)
+                    return min;
+            }
+            return w + d;
+        }
+    }
+
 private:
 
-    T w_{};
-    bool is_inf_;
+    static constexpr T inf_value = std::numeric_limits<T>::has_infinity
+                                 ? std::numeric_limits<T>::infinity()
+                                 : std::numeric_limits<T>::max();
+
+    T w_;
 };
 
+static_assert(sizeof(Distance<int>) == sizeof(int));
+
 // Equality
 
 template<arithmetic T>
-bool operator==(Distance<T> lhs, Distance<T> rhs) noexcept
-{
-    if (lhs.is_inf())
-        return rhs.is_inf();
-    else
-        return rhs.is_inf() ? false : *lhs == *rhs;
-}
+bool operator==(Distance<T> lhs, Distance<T> rhs) noexcept { return *lhs == *rhs; }
 
 template<arithmetic T>
-bool operator==(Distance<T> lhs, T rhs) noexcept { return lhs.is_inf() ? false : *lhs == rhs; }
+bool operator==(Distance<T> lhs, T rhs) noexcept { return !lhs.is_inf() && *lhs == rhs; }
 
 template<arithmetic T>
 bool operator==(T lhs, Distance<T> rhs) noexcept { return rhs == lhs; }
@@ -63,22 +95,19 @@ bool operator==(T lhs, Distance<T> rhs) noexcept { return rhs == lhs; }
 // Ordering
 
 template<arithmetic T>
-std::strong_ordering operator<=>(Distance<T> lhs, Distance<T> rhs) noexcept
+distance_ordering<T> operator<=>(Distance<T> lhs, Distance<T> rhs) noexcept
 {
-    if (lhs.is_inf())
-        return rhs.is_inf() ? std::strong_ordering::equal : std::strong_ordering::greater;
-    else
-        return rhs.is_inf() ? std::strong_ordering::less : *lhs <=> *rhs;
+    return *lhs <=> *rhs;
 }
 
 template<arithmetic T>
-std::strong_ordering operator<=>(Distance<T> lhs, T rhs) noexcept
+distance_ordering<T> operator<=>(Distance<T> lhs, T rhs) noexcept
 {
     return lhs.is_inf() ? std::strong_ordering::greater : *lhs <=> rhs;
 }
 
 template<arithmetic T>
-std::strong_ordering operator<=>(T lhs, Distance<T> rhs) noexcept
+distance_ordering<T> operator<=>(T lhs, Distance<T> rhs) noexcept
 {
     return rhs.is_inf() ? std::strong_ordering::less : lhs <=> *rhs;
 }
@@ -91,13 +120,13 @@ Distance<T> operator+(Distance<T> lhs, Distance<T> rhs) noexcept
     if (lhs.is_inf() || rhs.is_inf())
         return Distance<T>::inf();
     else
-        return *lhs + *rhs;
+        return Distance<T>::add(*lhs, *rhs);
 }
 
 template<arithmetic T>
 Distance<T> operator+(Distance<T> lhs, T rhs) noexcept
 {
-    return lhs.is_inf() ? Distance<T>::inf() : *lhs + rhs;
+    return lhs.is_inf() ? lhs : Distance<T>::add(*lhs, rhs);
 }
 
 template<arithmetic T>
@@ -0,0 +1,82 @@
+#ifndef INCLUDE_UTILS_EDGE_DEDUP_HPP
+#define INCLUDE_UTILS_EDGE_DEDUP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <numeric>
+#include <utility>
+#include <stdexcept>
+
+#include "utils/radix_sort.hpp"
+
+namespace graphs
+{
+
+// Which weight to keep if the same edge occurs several times
+enum class keep_weight { first, last, min };
+
+// A tag to be used if you want edges to be deduplicated by sorting packed keys of edges instead of
+// inserting them in node-based hash tables. Sorting is done on n_threads threads (0 stands for all
+// hardware threads).
+struct sorted_dedup final
+{
+    keep_weight keep = keep_weight::first;
+    unsigned n_threads = 0;
+};
+
+// Packs a pair of vertex indices in one key; keys are ordered like the pairs they come from.
+// Used by sorted deduplication, Edge_Map and KGraph construction alike
+inline std::uint64_t pack_edge(std::size_t from, std::size_t to)
+{
+    constexpr std::size_t max_index = std::numeric_limits<std::uint32_t>::max();
+    if (from > max_index || to > max_index)
+        throw std::length_error{"edge keys support vertex indices less than 2^32"};
+
+    return (static_cast<std::uint64_t>(from) << 32) | to;
+}
+
+inline std::pair<std::size_t, std::size_t> unpack_edge(std::uint64_t key) noexcept
+{
+    return std::pair{static_cast<std::size_t>(key >> 32),
+                     static_cast<std::size_t>(key & 0xFFFF'FFFF)};
+}
+
+// keys[i] is the packed key of the i-th edge; weight_less(i, j) compares weights of the i-th and
+// the j-th edges and is used only with keep_weight::min.
+// Returns pairs (key, index of kept edge) in ascending order of keys; of several edges with
+// minimal weight, the first one is kept.
+template<typename WeightLess>
+std::vector<std::pair<std::uint64_t, std::size_t>>
+dedup_edges(std::vector<std::uint64_t> keys, sorted_dedup opts, WeightLess weight_less)
+{
+    std::vector<std::size_t> indices(keys.size());
+    std::iota(indices.begin(), indices.end(), std::size_t{0});
+
+    radix_sort(keys, indices, opts.n_threads); // the sort is stable
+
+    std::vector<std::pair<std::uint64_t, std::size_t>> kept;
+
+    for (std::size_t i = 0; i != keys.size();)
+    {
+        std::size_t kept_i = indices[i];
+        std::size_t j = i + 1;
+
+        for (; j != keys.size() && keys[j] == keys[i]; ++j)
+        {
+            if (opts.keep == keep_weight::last ||
+                (opts.keep == keep_weight::min && weight_less(indices[j], kept_i)))
+                kept_i = indices[j];
+        }
+
+        kept.emplace_back(keys[i], kept_i);
+        i = j;
+    }
+
+    return kept;
+}
+
+} // namespace graphs
+
+#endif // INCLUDE_UTILS_EDGE_DEDUP_HPP
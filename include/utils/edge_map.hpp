@@ -0,0 +1,250 @@
+#ifndef INCLUDE_UTILS_EDGE_MAP_HPP
+#define INCLUDE_UTILS_EDGE_MAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <ranges>
+#include <bit>
+#include <concepts>
+#include <stdexcept>
+#include <format>
+
+#include "utils/edge_dedup.hpp"
+
+namespace graphs
+{
+
+// Hash table with edges (pairs of vertex indices less than 2^32) as keys. Keys are packed in 64-bit
+// integers (see pack_edge()) and stored along with values in one array; collisions are resolved by
+// linear probing with Robin Hood displacement, and erased entries are filled by shifting the
+// following entries back, so there are no tombstones. Unlike node-based std::unordered_map, there
+// is no allocation per entry, and a lookup usually reads one cache line.
+//
+// Note: any insertion or erasure invalidates pointers and references to values.
+
+template<std::default_initializable Value>
+class Edge_Map final
+{
+public:
+
+    using key_type = std::pair<std::size_t, std::size_t>;
+    using mapped_type = Value;
+    using size_type = std::size_t;
+
+    Edge_Map() = default;
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    size_type bucket_count() const noexcept { return slots_.size(); }
+
+    // the number of bytes used by the table
+    size_type memory_usage() const noexcept
+    {
+        return slots_.capacity() * sizeof(Slot) + probes_.capacity() * sizeof(std::uint8_t);
+    }
+
+    void clear()
+    {
+        slots_.clear();
+        probes_.clear();
+        size_ = 0;
+    }
+
+    // makes room for n entries without rehashing
+    void reserve(size_type n)
+    {
+        size_type n_buckets = min_buckets;
+        while (n * max_load_den > n_buckets * max_load_num)
+            n_buckets *= 2;
+
+        if (n_buckets > bucket_count())
+            rehash(n_buckets);
+    }
+
+    // returns pointer to the value or nullptr if there is no such key. O(1) on average
+    const Value *find(const key_type &key) const
+    {
+        const size_type i = find_index(pack_edge(key.first, key.second));
+        return i == npos ? nullptr : &slots_[i].value;
+    }
+
+    Value *find(const key_type &key)
+    {
+        return const_cast<Value *>(std::as_const(*this).find(key));
+    }
+
+    bool contains(const key_type &key) const { return find(key) != nullptr; }
+
+    const Value &at(const key_type &key) const
+    {
+        if (auto value = find(key))
+            return *value;
+        throw std::out_of_range{std::format("no edge ({}, {}) in the map", key.first, key.second)};
+    }
+
+    Value &at(const key_type &key) { return const_cast<Value &>(std::as_const(*this).at(key)); }
+
+    // Inserts (key, value) unless there is already an entry with such key; returns true if the
+    // entry was inserted. O(1) on average
+    bool emplace(const key_type &key, Value value)
+    {
+        const std::uint64_t packed = pack_edge(key.first, key.second);
+        if (find_index(packed) != npos)
+            return false;
+
+        insert(packed, std::move(value));
+        return true;
+    }
+
+    Value &operator[](const key_type &key)
+    {
+        const std::uint64_t packed = pack_edge(key.first, key.second);
+        if (auto i = find_index(packed); i != npos)
+            return slots_[i].value;
+
+        insert(packed, Value{});
+        return slots_[find_index(packed)].value;
+    }
+
+    // returns the number of erased entries. O(1) on average
+    size_type erase(const key_type &key)
+    {
+        size_type i = find_index(pack_edge(key.first, key.second));
+        if (i == npos)
+            return 0;
+
+        // shifting back the entries following the erased one until an empty slot or an entry in
+        // its home slot is met
+
+        for (size_type next = (i + 1) & mask(); probes_[next] > 1; next = (next + 1) & mask())
+        {
+            slots_[i] = std::move(slots_[next]);
+            probes_[i] = probes_[next] - 1;
+            i = next;
+        }
+
+        slots_[i].value = Value{};
+        probes_[i] = 0;
+        --size_;
+
+        return 1;
+    }
+
+    // calls f(key, value) for every entry in unspecified order
+    template<typename F>
+    void for_each(F f) const
+    {
+        for (auto i : std::views::iota(size_type{0}, bucket_count()))
+        {
+            if (probes_[i] != 0)
+                f(unpack_edge(slots_[i].key), slots_[i].value);
+        }
+    }
+
+    template<typename F>
+    void for_each(F f)
+    {
+        for (auto i : std::views::iota(size_type{0}, bucket_count()))
+        {
+            if (probes_[i] != 0)
+                f(unpack_edge(slots_[i].key), slots_[i].value);
+        }
+    }
+
+private:
+
+    struct Slot final
+    {
+        std::uint64_t key;
+        [[no_unique_address]] Value value;
+    };
+
+    static constexpr size_type min_buckets = 16;
+    static constexpr size_type max_load_num = 7; // the maximum load factor is 7/8
+    static constexpr size_type max_load_den = 8;
+    static constexpr std::uint8_t max_probe = 255;
+    static constexpr size_type npos = -1;
+
+    size_type mask() const noexcept { return bucket_count() - 1; }
+
+    // Fibonacci hashing: the highest bits of the product are the best mixed ones
+    size_type home(std::uint64_t key) const noexcept
+    {
+        return (key * 0x9E37'79B9'7F4A'7C15) >> (64 - std::countr_zero(bucket_count()));
+    }
+
+    size_type find_index(std::uint64_t key) const noexcept
+    {
+        if (empty())
+            return npos;
+
+        // probes_[i] is 1 + the distance of the entry in slot i from its home slot or 0 if the
+        // slot is empty; an entry can't be further from its home than the probed slots
+
+        size_type i = home(key);
+        for (std::uint8_t probe = 1; probes_[i] >= probe; ++probe, i = (i + 1) & mask())
+        {
+            if (slots_[i].key == key)
+                return i;
+        }
+
+        return npos;
+    }
+
+    // key must not be in the table
+    void insert(std::uint64_t key, Value value)
+    {
+        if ((size_ + 1) * max_load_den > bucket_count() * max_load_num)
+            rehash(std::max(bucket_count() * 2, min_buckets));
+
+        Slot slot{key, std::move(value)};
+        size_type i = home(key);
+        std::uint8_t probe = 1;
+
+        while (probes_[i] != 0)
+        {
+            // an entry which is closer to its home gives its slot up
+            if (probes_[i] < probe)
+            {
+                std::swap(slot, slots_[i]);
+                std::swap(probe, probes_[i]);
+            }
+
+            i = (i + 1) & mask();
+            if (++probe == max_probe)
+            {
+                rehash(bucket_count() * 2);
+                insert(slot.key, std::move(slot.value));
+                return;
+            }
+        }
+
+        slots_[i] = std::move(slot);
+        probes_[i] = probe;
+        ++size_;
+    }
+
+    void rehash(size_type n_buckets)
+    {
+        auto slots = std::exchange(slots_, std::vector<Slot>(n_buckets));
+        auto probes = std::exchange(probes_, std::vector<std::uint8_t>(n_buckets));
+        size_ = 0;
+
+        for (auto i : std::views::iota(size_type{0}, slots.size()))
+        {
+            if (probes[i] != 0)
+                insert(slots[i].key, std::move(slots[i].value));
+        }
+    }
+
+    std::vector<Slot> slots_;
+    std::vector<std::uint8_t> probes_;
+    size_type size_ = 0;
+};
+
+} // namespace graphs
+
+#endif // INCLUDE_UTILS_EDGE_MAP_HPP
@@ -1,6 +1,9 @@
 #ifndef INCLUDE_UTILS_GRAPH_TRAITS_HPP
 #define INCLUDE_UTILS_GRAPH_TRAITS_HPP
 
+#include <utility>
+#include <ranges>
+
 namespace graphs
 {
 
@@ -32,9 +35,60 @@ struct graph_traits
  *
  * static const weight_type &weight(const G &g, size_type from, size_type to)
  *     - returns reference to const weight of the edge connecting nodes with indexes "from" and "to".
+ *
+ * Optional elements:
+ * ~~~~~~~~~~~~~~~~~~
+ *
+ * static auto adjacent_edges(const G &g, size_type i)
+ *     - returns a range of pairs (j, w) where j is an index of an adjacent node of the node with
+ *       index i and w is the weight of the edge connecting them. Algorithms prefer it to calling
+ *       weight() for every element of adjacent_vertices().
+ *
+ * static auto incoming_vertices(const G &g, size_type i)
+ *     - returns a range of indexes of nodes "from" such that there is an edge from "from" to the
+ *       node with index i. Makes it possible to traverse the transpose of the graph (see
+ *       utils/transposed_traits.hpp).
+ *
+ * static auto incoming_edges(const G &g, size_type i)
+ *     - returns a range of pairs (j, w) where j is an element of incoming_vertices(g, i) and w is
+ *       the weight of the edge from j to i. Traversals of the transpose prefer it to calling
+ *       weight() for every element of incoming_vertices().
  */
 };
 
+template<typename Traits, typename G>
+concept has_adjacent_edges = requires(const G &g, typename Traits::size_type i)
+{
+    { Traits::adjacent_edges(g, i) } -> std::ranges::input_range;
+};
+
+template<typename Traits, typename G>
+concept has_incoming_vertices = requires(const G &g, typename Traits::size_type i)
+{
+    { Traits::incoming_vertices(g, i) } -> std::ranges::input_range;
+};
+
+template<typename Traits, typename G>
+concept has_incoming_edges = requires(const G &g, typename Traits::size_type i)
+{
+    { Traits::incoming_edges(g, i) } -> std::ranges::input_range;
+};
+
+// Returns Traits::adjacent_edges(g, i) if it's provided; otherwise, emulates it with
+// Traits::adjacent_vertices() and Traits::weight()
+template<typename Traits, typename G>
+auto adjacent_edges(const G &g, typename Traits::size_type i)
+{
+    if constexpr (has_adjacent_edges<Traits, G>)
+        return Traits::adjacent_edges(g, i);
+    else
+        return Traits::adjacent_vertices(g, i) |
+               std::views::transform([&g, i](typename Traits::size_type j)
+               {
+                   return std::pair{j, Traits::weight(g, i, j)};
+               });
+}
+
 } // namespace graphs
 
 #endif // INCLUDE_UTILS_GRAPH_TRAITS_HPP
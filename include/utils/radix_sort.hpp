@@ -0,0 +1,117 @@
+#ifndef INCLUDE_UTILS_RADIX_SORT_HPP
+#define INCLUDE_UTILS_RADIX_SORT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <ranges>
+#include <utility>
+#include <cassert>
+
+namespace graphs
+{
+
+// Runs f(0), f(1), ..., f(n_threads - 1) concurrently; f(0) is run by the calling thread
+template<typename F>
+void parallel_for(unsigned n_threads, F f)
+{
+    std::vector<std::jthread> threads;
+    threads.reserve(n_threads - 1);
+
+    for (auto t : std::views::iota(1u, n_threads))
+        threads.emplace_back(f, t);
+
+    f(0u);
+}
+
+// Returns the number of threads to use for processing n elements: no more than requested (all
+// hardware threads if n_threads == 0) and no more than one thread per min_chunk elements
+inline unsigned choose_n_threads(std::size_t n, unsigned n_threads, std::size_t min_chunk = 1 << 16)
+{
+    if (n_threads == 0)
+        n_threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+    const std::size_t max_threads = std::max(n / min_chunk, std::size_t{1});
+    return static_cast<unsigned>(std::min<std::size_t>(n_threads, max_threads));
+}
+
+// Stable LSD radix sort of keys; values[i] is moved along with keys[i]. Each pass builds
+// per-thread histograms of a chunk of the input and then scatters the chunks concurrently. Passes
+// over digits that are equal in all keys are skipped.
+template<typename Value>
+void radix_sort(std::vector<std::uint64_t> &keys, std::vector<Value> &values,
+                unsigned n_threads = 0)
+{
+    assert(keys.size() == values.size());
+
+    constexpr unsigned digit_bits = 8;
+    constexpr std::size_t n_buckets = std::size_t{1} << digit_bits;
+    using histogram = std::array<std::size_t, n_buckets>;
+
+    const std::size_t n = keys.size();
+    if (n < 2)
+        return;
+
+    n_threads = choose_n_threads(n, n_threads);
+
+    auto chunk_first = [n, n_threads](unsigned t){ return n * t / n_threads; };
+
+    const std::uint64_t all_bits =
+        std::accumulate(keys.begin(), keys.end(), std::uint64_t{0}, std::bit_or<std::uint64_t>{});
+
+    std::vector<std::uint64_t> keys_buf(n);
+    std::vector<Value> values_buf(n);
+    std::vector<histogram> counts(n_threads);
+
+    for (unsigned shift = 0; shift < 64 && (all_bits >> shift) != 0; shift += digit_bits)
+    {
+        auto digit = [shift](std::uint64_t key){ return (key >> shift) & (n_buckets - 1); };
+
+        parallel_for(n_threads, [&](unsigned t)
+        {
+            counts[t].fill(0);
+            for (auto i : std::views::iota(chunk_first(t), chunk_first(t + 1)))
+                ++counts[t][digit(keys[i])];
+        });
+
+        // turning counts into positions where each thread starts writing each bucket
+
+        std::size_t position = 0;
+        std::size_t max_bucket = 0;
+        for (auto b : std::views::iota(std::size_t{0}, n_buckets))
+        {
+            std::size_t bucket = 0;
+            for (auto &count : counts)
+            {
+                bucket += count[b];
+                count[b] = std::exchange(position, position + count[b]);
+            }
+            max_bucket = std::max(max_bucket, bucket);
+        }
+
+        if (max_bucket == n) // all keys have the same digit
+            continue;
+
+        parallel_for(n_threads, [&](unsigned t)
+        {
+            for (auto i : std::views::iota(chunk_first(t), chunk_first(t + 1)))
+            {
+                const std::size_t j = counts[t][digit(keys[i])]++;
+                keys_buf[j] = keys[i];
+                values_buf[j] = std::move(values[i]);
+            }
+        });
+
+        std::swap(keys, keys_buf);
+        std::swap(values, values_buf);
+    }
+}
+
+} // namespace graphs
+
+#endif // INCLUDE_UTILS_RADIX_SORT_HPP
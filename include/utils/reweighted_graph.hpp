@@ -0,0 +1,110 @@
+#ifndef INCLUDE_UTILS_REWEIGHTED_GRAPH_HPP
+#define INCLUDE_UTILS_REWEIGHTED_GRAPH_HPP
+
+#include <span>
+#include <utility>
+#include <ranges>
+#include <algorithm>
+#include <concepts>
+
+#include "utils/graph_traits.hpp"
+
+namespace graphs
+{
+
+// A view of a graph in which the weight of every edge (u, v) is w(u, v) + h(u) - h(v) for the
+// given potentials h. Weights are computed when edges are traversed, so neither the graph nor the
+// potentials are copied, and both must outlive the view. Johnson's algorithm runs Dijkstra's
+// algorithm on such a view with potentials computed by Bellman-Ford algorithm, which makes all
+// weights non-negative.
+template<typename G, typename Traits = graph_traits<G>> // G stands for "graph"
+class Reweighted_Graph final
+{
+public:
+
+    using size_type = typename Traits::size_type;
+    using weight_type = typename Traits::weight_type;
+
+    // potentials[i] is the potential of the vertex with index i
+    Reweighted_Graph(const G &g, std::span<const weight_type> potentials) noexcept
+        : g_{&g}, potentials_{potentials} {}
+
+    const G &graph() const noexcept { return *g_; }
+
+    weight_type potential(size_type i) const { return potentials_[i]; }
+
+    weight_type reweight(size_type from, size_type to, weight_type w) const
+    {
+        weight_type new_w = w + (potentials_[from] - potentials_[to]);
+
+        // new weights computed with potentials from Bellman-Ford algorithm are non-negative, but
+        // rounding errors may make them slightly less than zero which Dijkstra's algorithm doesn't
+        // accept
+        if constexpr (std::floating_point<weight_type>)
+            new_w = std::max(new_w, weight_type{0});
+
+        return new_w;
+    }
+
+private:
+
+    const G *g_;
+    std::span<const weight_type> potentials_;
+};
+
+// Weights of a reweighted graph are computed, so weight() returns them by value
+template<typename G, typename Traits>
+struct graph_traits<Reweighted_Graph<G, Traits>>
+{
+    using graph_type = Reweighted_Graph<G, Traits>;
+
+    using size_type = typename Traits::size_type;
+    using vertex_type = typename Traits::vertex_type;
+    using weight_type = typename Traits::weight_type;
+
+    static constexpr bool is_directed = Traits::is_directed;
+
+    static size_type n_vertices(const graph_type &g) { return Traits::n_vertices(g.graph()); }
+    static size_type n_edges(const graph_type &g) { return Traits::n_edges(g.graph()); }
+
+    static auto adjacent_vertices(const graph_type &g, size_type i)
+    {
+        return Traits::adjacent_vertices(g.graph(), i);
+    }
+
+    static auto incoming_vertices(const graph_type &g, size_type i)
+    requires has_incoming_vertices<Traits, G>
+    {
+        return Traits::incoming_vertices(g.graph(), i);
+    }
+
+    static weight_type weight(const graph_type &g, size_type from, size_type to)
+    {
+        return g.reweight(from, to, Traits::weight(g.graph(), from, to));
+    }
+
+    static auto adjacent_edges(const graph_type &g, size_type i)
+    {
+        return graphs::adjacent_edges<Traits>(g.graph(), i) |
+               std::views::transform([&g, i](const auto &edge)
+               {
+                   const auto &[j, w] = edge;
+                   return std::pair{j, g.reweight(i, j, w)};
+               });
+    }
+
+    static auto incoming_edges(const graph_type &g, size_type i)
+    requires has_incoming_edges<Traits, G>
+    {
+        return Traits::incoming_edges(g.graph(), i) |
+               std::views::transform([&g, i](const auto &edge)
+               {
+                   const auto &[j, w] = edge;
+                   return std::pair{j, g.reweight(j, i, w)};
+               });
+    }
+};
+
+} // namespace graphs
+
+#endif // INCLUDE_UTILS_REWEIGHTED_GRAPH_HPP
@@ -0,0 +1,70 @@
+#ifndef INCLUDE_UTILS_TRANSPOSED_TRAITS_HPP
+#define INCLUDE_UTILS_TRANSPOSED_TRAITS_HPP
+
+#include <utility>
+#include <ranges>
+
+#include "utils/graph_traits.hpp"
+
+namespace graphs
+{
+
+// Traits of the transpose of a graph: every edge (u, v) of the graph is seen as the edge (v, u).
+// Passing them to an algorithm instead of graph_traits<G> makes it traverse edges backwards
+// without copying the graph, for example:
+//
+//     BFS<G, transposed_traits<G>> bfs{g, s}; // distances from every vertex to s
+//
+// The graph must provide incoming_vertices(). If it also provides incoming_edges(), weights of
+// the transpose are read from them rather than looked up edge by edge.
+
+template<typename G, typename Traits = graph_traits<G>> // G stands for "graph"
+requires has_incoming_vertices<Traits, G>
+struct transposed_traits
+{
+    using size_type = typename Traits::size_type;
+    using vertex_type = typename Traits::vertex_type;
+    using weight_type = typename Traits::weight_type;
+
+    static constexpr bool is_directed = Traits::is_directed;
+
+    static size_type n_vertices(const G &g) { return Traits::n_vertices(g); }
+    static size_type n_edges(const G &g) { return Traits::n_edges(g); }
+
+    static auto adjacent_vertices(const G &g, size_type i)
+    {
+        return Traits::incoming_vertices(g, i);
+    }
+
+    static auto incoming_vertices(const G &g, size_type i)
+    {
+        return Traits::adjacent_vertices(g, i);
+    }
+
+    static auto adjacent_edges(const G &g, size_type i)
+    {
+        if constexpr (has_incoming_edges<Traits, G>)
+            return Traits::incoming_edges(g, i);
+        else
+            return Traits::incoming_vertices(g, i) |
+                   std::views::transform([&g, i](size_type j)
+                   {
+                       return std::pair{j, weight_type{Traits::weight(g, j, i)}};
+                   });
+    }
+
+    static auto incoming_edges(const G &g, size_type i)
+    {
+        return graphs::adjacent_edges<Traits>(g, i);
+    }
+
+    // by value since Traits::weight() may return a computed weight
+    static weight_type weight(const G &g, size_type from, size_type to)
+    {
+        return Traits::weight(g, to, from);
+    }
+};
+
+} // namespace graphs
+
+#endif // INCLUDE_UTILS_TRANSPOSED_TRAITS_HPP
@@ -0,0 +1,385 @@
+#ifndef INCLUDE_UTILS_VERTEX_QUEUE_HPP
+#define INCLUDE_UTILS_VERTEX_QUEUE_HPP
+
+#include <cstddef>
+#include <array>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <ranges>
+#include <bit>
+#include <limits>
+#include <concepts>
+#include <type_traits>
+
+#include <boost/heap/fibonacci_heap.hpp>
+
+namespace graphs
+{
+
+// Policies of priority queues of vertices used by Dijkstra's algorithm:
+// - fibonacci_heap: boost::heap::fibonacci_heap. O(1) push and decrease-key and O(log(n)) pop,
+//   but every entry is a separately allocated node, and pop() chases pointers
+// - d_ary_heap<Arity>: an implicit Arity-ary heap in one array; the position of every vertex in
+//   the array is kept for decrease-key. O(log(n)) push and decrease-key and O(Arity * log(n)) pop.
+//   The heap is shallower than a binary one, and children of a node share a cache line
+// - lazy_heap: an implicit binary heap without decrease-key: a vertex is pushed once more every
+//   time its key decreases, and pop() returns stale entries which the caller has to skip.
+//   O(log(n)) per operation, where n counts stale entries too, and no memory per vertex
+// - radix_heap: a monotone radix heap with lazy decrease-key like lazy_heap. Keys must be
+//   integers not less than the last popped key, which holds in Dijkstra's algorithm. An entry is
+//   moved to another bucket at most once per bit of the key, so the amortized cost of a pop is
+//   O(log(C)), where C is the maximal weight, rather than a number of comparisons of keys
+// - dial_buckets: Dial's circular array of buckets of vertices with equal keys with lazy
+//   decrease-key like lazy_heap. Keys must be integers not less than the last popped key. Push is
+//   O(1), and all pops cost O(n + C) together. The array grows up to the smallest power of 2 which
+//   is greater than C, so C doesn't have to be known beforehand, but it must be small
+struct fibonacci_heap final {};
+
+template<std::size_t Arity>
+requires (Arity >= 2)
+struct d_ary_heap final {};
+
+struct lazy_heap final {};
+struct radix_heap final {};
+struct dial_buckets final {};
+
+// The policy Dijkstra's algorithm uses by default for weights of type W: if W is an integral type
+// of at most 16 bits, weights are known to be small enough for dial_buckets
+template<typename W>
+using default_queue = std::conditional_t<std::integral<W>,
+                                         std::conditional_t<(sizeof(W) <= 2), dial_buckets,
+                                                            radix_heap>,
+                                         d_ary_heap<4>>;
+
+// Priority queue of vertices (indices less than the number given to reset()) keyed by distances
+// with the nearest vertex on top. Every specialization provides:
+//
+//     void reset(I n_vertices);    // makes the queue empty keeping the memory it has allocated
+//     bool empty() const;
+//     void push(I i, D d);         // vertex i must not be in the queue
+//     void decrease(I i, D d);     // vertex i must be in the queue with a key not less than d
+//     std::pair<I, D> pop();       // removes the vertex with the least key
+template<typename Policy, typename I, typename D>
+class Vertex_Queue;
+
+template<typename I, typename D>
+class Vertex_Queue<fibonacci_heap, I, D> final
+{
+    using priority_pair = std::pair<I, D>;
+
+    // we cannot mark this class final because boost inherits from it
+    struct priority_comp
+    {
+        bool operator()(const priority_pair &lhs, const priority_pair &rhs) const
+        {
+            return lhs.second > rhs.second;
+        }
+    };
+
+    using heap_type = boost::heap::fibonacci_heap<priority_pair,
+                                                  boost::heap::compare<priority_comp>>;
+
+public:
+
+    void reset(I n_vertices)
+    {
+        heap_.clear();
+        handles_.resize(n_vertices);
+    }
+
+    bool empty() const noexcept { return heap_.empty(); }
+
+    void push(I i, D d) { handles_[i] = heap_.emplace(i, d); }
+
+    void decrease(I i, D d) { heap_.decrease(handles_[i], priority_pair{i, d}); }
+
+    priority_pair pop()
+    {
+        priority_pair top = heap_.top();
+        heap_.pop();
+        return top;
+    }
+
+private:
+
+    heap_type heap_;
+    std::vector<typename heap_type::handle_type> handles_;
+};
+
+template<std::size_t Arity, typename I, typename D>
+class Vertex_Queue<d_ary_heap<Arity>, I, D> final
+{
+public:
+
+    void reset(I n_vertices)
+    {
+        heap_.clear();
+        positions_.resize(n_vertices);
+    }
+
+    bool empty() const noexcept { return heap_.empty(); }
+
+    void push(I i, D d)
+    {
+        heap_.push_back(Node{d, i});
+        sift_up(heap_.size() - 1, heap_.back());
+    }
+
+    void decrease(I i, D d) { sift_up(positions_[i], Node{d, i}); }
+
+    std::pair<I, D> pop()
+    {
+        const Node top = heap_.front();
+        const Node last = heap_.back();
+        heap_.pop_back();
+
+        if (!heap_.empty())
+            sift_down(0, last);
+
+        return {top.vertex, top.key};
+    }
+
+private:
+
+    struct Node final
+    {
+        D key;
+        I vertex;
+    };
+
+    // moves node up from position pos, which is a hole, until its parent has not greater key
+    void sift_up(std::size_t pos, Node node)
+    {
+        while (pos != 0)
+        {
+            const std::size_t parent = (pos - 1) / Arity;
+            if (!(node.key < heap_[parent].key))
+                break;
+
+            place(pos, heap_[parent]);
+            pos = parent;
+        }
+
+        place(pos, node);
+    }
+
+    // moves node down from position pos, which is a hole, until its children have not less keys
+    void sift_down(std::size_t pos, Node node)
+    {
+        const std::size_t size = heap_.size();
+
+        for (std::size_t first = Arity * pos + 1; first < size; first = Arity * pos + 1)
+        {
+            const std::size_t last = std::min(first + Arity, size);
+
+            std::size_t min = first;
+            for (std::size_t child = first + 1; child < last; ++child)
+            {
+                if (heap_[child].key < heap_[min].key)
+                    min = child;
+            }
+
+            if (!(heap_[min].key < node.key))
+                break;
+
+            place(pos, heap_[min]);
+            pos = min;
+        }
+
+        place(pos, node);
+    }
+
+    void place(std::size_t pos, const Node &node)
+    {
+        heap_[pos] = node;
+        positions_[node.vertex] = static_cast<I>(pos);
+    }
+
+    std::vector<Node> heap_;
+    std::vector<I> positions_;
+};
+
+template<typename I, typename D>
+class Vertex_Queue<lazy_heap, I, D> final
+{
+    using priority_pair = std::pair<I, D>;
+
+public:
+
+    void reset(I) { heap_.clear(); }
+
+    bool empty() const noexcept { return heap_.empty(); }
+
+    void push(I i, D d)
+    {
+        heap_.emplace_back(i, d);
+        std::ranges::push_heap(heap_, comp);
+    }
+
+    // the old entry of vertex i becomes stale
+    void decrease(I i, D d) { push(i, d); }
+
+    priority_pair pop()
+    {
+        std::ranges::pop_heap(heap_, comp);
+
+        priority_pair top = heap_.back();
+        heap_.pop_back();
+        return top;
+    }
+
+private:
+
+    static bool comp(const priority_pair &lhs, const priority_pair &rhs)
+    {
+        return lhs.second > rhs.second;
+    }
+
+    std::vector<priority_pair> heap_;
+};
+
+template<typename I, typename D>
+requires std::integral<typename D::value_type>
+class Vertex_Queue<radix_heap, I, D> final
+{
+    using value_type = typename D::value_type;
+    using key_type = std::make_unsigned_t<value_type>;
+    using entry = std::pair<I, key_type>;
+
+    static constexpr std::size_t n_buckets = std::numeric_limits<key_type>::digits + 1;
+
+public:
+
+    void reset(I)
+    {
+        for (auto &bucket : buckets_)
+            bucket.clear();
+
+        last_ = 0;
+        size_ = 0;
+    }
+
+    bool empty() const noexcept { return size_ == 0; }
+
+    void push(I i, D d)
+    {
+        const auto key = static_cast<key_type>(*d);
+        buckets_[bucket(key)].emplace_back(i, key);
+        ++size_;
+    }
+
+    // the old entry of vertex i becomes stale
+    void decrease(I i, D d) { push(i, d); }
+
+    std::pair<I, D> pop()
+    {
+        // Bucket b > 0 holds keys whose highest bit differing from the last popped key is bit b-1.
+        // When the minimum of the first non-empty bucket becomes the last popped key, the entries
+        // of this bucket move to lower buckets
+
+        if (buckets_[0].empty())
+        {
+            auto it = std::ranges::find_if(buckets_, [](const auto &b){ return !b.empty(); });
+
+            last_ = std::ranges::min(*it, {}, &entry::second).second;
+            for (auto [i, key] : *it)
+                buckets_[bucket(key)].emplace_back(i, key);
+
+            it->clear();
+        }
+
+        const auto [i, key] = buckets_[0].back();
+        buckets_[0].pop_back();
+        --size_;
+
+        return {i, static_cast<value_type>(key)};
+    }
+
+private:
+
+    std::size_t bucket(key_type key) const noexcept
+    {
+        return std::bit_width(static_cast<key_type>(key ^ last_));
+    }
+
+    std::array<std::vector<entry>, n_buckets> buckets_;
+    key_type last_ = 0;
+    std::size_t size_ = 0;
+};
+
+template<typename I, typename D>
+requires std::integral<typename D::value_type>
+class Vertex_Queue<dial_buckets, I, D> final
+{
+    using value_type = typename D::value_type;
+
+public:
+
+    void reset(I)
+    {
+        for (auto &bucket : buckets_)
+            bucket.clear();
+
+        current_ = 0;
+        size_ = 0;
+    }
+
+    bool empty() const noexcept { return size_ == 0; }
+
+    void push(I i, D d)
+    {
+        const auto span = static_cast<std::size_t>(*d - current_);
+        if (span >= buckets_.size())
+            grow(span + 1);
+
+        buckets_[index(*d)].push_back(i);
+        ++size_;
+    }
+
+    // the old entry of vertex i becomes stale
+    void decrease(I i, D d) { push(i, d); }
+
+    std::pair<I, D> pop()
+    {
+        while (buckets_[index(current_)].empty())
+            ++current_;
+
+        auto &bucket = buckets_[index(current_)];
+        const I i = bucket.back();
+        bucket.pop_back();
+        --size_;
+
+        return {i, current_};
+    }
+
+private:
+
+    // all keys are in [current_, current_ + buckets_.size()), so the bucket of key k is the one
+    // with index k modulo the number of buckets
+    std::size_t index(value_type key) const noexcept
+    {
+        return static_cast<std::size_t>(key) & (buckets_.size() - 1);
+    }
+
+    void grow(std::size_t min_size)
+    {
+        std::vector<std::vector<I>> buckets(std::bit_ceil(min_size));
+        std::swap(buckets, buckets_);
+        const std::size_t old_mask = buckets.size() - 1;
+
+        for (auto j : std::views::iota(0uz, buckets.size()))
+        {
+            const auto key = current_ + static_cast<value_type>((j - current_) & old_mask);
+            buckets_[index(key)] = std::move(buckets[j]);
+        }
+    }
+
+    std::vector<std::vector<I>> buckets_ = std::vector<std::vector<I>>(1);
+    value_type current_ = 0;
+    std::size_t size_ = 0;
+};
+
+} // namespace graphs
+
+#endif // INCLUDE_UTILS_VERTEX_QUEUE_HPP
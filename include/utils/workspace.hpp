@@ -0,0 +1,147 @@
+#ifndef INCLUDE_UTILS_WORKSPACE_HPP
+#define INCLUDE_UTILS_WORKSPACE_HPP
+
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+#include <variant>
+#include <algorithm>
+#include <stdexcept>
+#include <format>
+
+namespace graphs
+{
+
+// State of a graph search: per-vertex distances, predecessors and marks (colors) and an object of
+// type Extra which an algorithm may use for its own needs (for example, Dijkstra's algorithm keeps
+// its priority queue there). A workspace can be passed to BFS, Dijkstra, A_Star, Bellman_Ford and
+// Delta_Stepping to be reused by many runs on the same graph: it remembers which vertices a run
+// touched, and reset() restores only them, so a run which reaches a few vertices of a huge graph
+// neither pays for the rest of the graph nor allocates memory.
+//
+// A vertex is touched if its distance is finite or it's marked. Untouched vertices have infinite
+// distances, nil predecessors and no marks. The extra object isn't reset.
+
+template<typename D, typename I = std::size_t, typename Extra = std::monostate>
+class Workspace final
+{
+public:
+
+    using distance_type = D;
+    using size_type = I;
+    using extra_type = Extra;
+
+    static constexpr size_type nil = std::numeric_limits<size_type>::max();
+
+    Workspace() = default;
+
+    // Makes all vertices of a graph with n_vertices vertices untouched. O(touched) if the previous
+    // run was on a graph with as many vertices and O(V) otherwise
+    void reset(size_type n_vertices)
+    {
+        if (n_vertices != this->n_vertices())
+        {
+            distances_.assign(n_vertices, distance_type{});
+            predecessors_.assign(n_vertices, nil);
+            marks_.assign(n_vertices, false);
+        }
+        else
+        {
+            for (auto i : touched_)
+            {
+                distances_[i] = distance_type{};
+                predecessors_[i] = nil;
+                marks_[i] = false;
+            }
+        }
+
+        touched_.clear();
+    }
+
+    size_type n_vertices() const noexcept { return distances_.size(); }
+
+    // touched vertices in the order they were touched first or passed to touch()
+    std::span<const size_type> touched() const noexcept { return touched_; }
+
+    const distance_type &distance(size_type i) const { return distances_[i]; }
+    size_type predecessor(size_type i) const { return predecessors_[i]; }
+    bool marked(size_type i) const { return marks_[i]; }
+
+    extra_type &extra() noexcept { return extra_; }
+    const extra_type &extra() const noexcept { return extra_; }
+
+    // d must be finite
+    void set_distance(size_type i, distance_type d, size_type predecessor = nil)
+    {
+        if (!is_touched(i))
+            touched_.push_back(i);
+
+        distances_[i] = d;
+        predecessors_[i] = predecessor;
+    }
+
+    // Like set_distance() but vertex i isn't remembered as touched, so different threads may set
+    // distances of different vertices at once. Every vertex whose distance was infinite has to be
+    // passed to touch() afterwards
+    void set_distance_unrecorded(size_type i, distance_type d, size_type predecessor = nil)
+    {
+        distances_[i] = d;
+        predecessors_[i] = predecessor;
+    }
+
+    // i must have been untouched before set_distance_unrecorded() was called for it
+    void touch(size_type i) { touched_.push_back(i); }
+
+    void mark(size_type i)
+    {
+        if (!is_touched(i))
+            touched_.push_back(i);
+
+        marks_[i] = true;
+    }
+
+    // the vertex stays touched
+    void unmark(size_type i) { marks_[i] = false; }
+
+    bool is_touched(size_type i) const { return marks_[i] || !distances_[i].is_inf(); }
+
+    std::span<const distance_type> distances() const noexcept { return distances_; }
+    std::span<const size_type> predecessors() const noexcept { return predecessors_; }
+
+    void check_index(size_type i) const
+    {
+        if (i >= n_vertices())
+            throw std::out_of_range{std::format("no vertex with index {}", i)};
+    }
+
+    // the path from the source to vertex i following predecessors or an empty path if i is
+    // unreachable
+    std::vector<size_type> path_to(size_type i) const
+    {
+        check_index(i);
+        if (distances_[i].is_inf())
+            return {};
+
+        std::vector path{i};
+
+        for (i = predecessors_[i]; i != nil; i = predecessors_[i])
+            path.push_back(i);
+
+        std::ranges::reverse(path);
+
+        return path;
+    }
+
+private:
+
+    std::vector<distance_type> distances_;
+    std::vector<size_type> predecessors_;
+    std::vector<bool> marks_;
+    std::vector<size_type> touched_;
+    [[no_unique_address]] extra_type extra_;
+};
+
+} // namespace graphs
+
+#endif // INCLUDE_UTILS_WORKSPACE_HPP
@@ -0,0 +1,94 @@
+#include <iostream>
+#include <random>
+#include <vector>
+#include <tuple>
+#include <chrono>
+#include <cstddef>
+
+#include "graphs/csr_graph.hpp"
+#include "algorithms/bellman_ford.hpp"
+
+#include "random_graph.hpp"
+
+namespace
+{
+
+using G = graphs::CSR_Graph<int>;
+
+// Random graph with weights w(u, v) = b(u, v) + p(u) - p(v) where b(u, v) is in
+// [0, max-weight-modulo] and p(u), p(v) are in [-max-weight-modulo, max-weight-modulo]. Many
+// weights are negative, but weights of all cycles are not
+G generate_graph(const Random_Graph_Options &opts, std::mt19937_64 &gen)
+{
+    std::uniform_int_distribution<std::size_t> vertex{0, opts.n_vertices() - 1};
+    std::uniform_int_distribution<int> base{0, opts.max_weight_modulo()};
+    std::uniform_int_distribution<int> potential{-opts.max_weight_modulo(),
+                                                 opts.max_weight_modulo()};
+
+    std::vector<int> vertices(opts.n_vertices());
+    for (auto &p : vertices)
+        p = potential(gen);
+
+    std::vector<std::tuple<std::size_t, std::size_t, int>> edges;
+    edges.reserve(opts.n_edges());
+
+    for (auto e = 0uz; e != opts.n_edges(); ++e)
+    {
+        const auto u = vertex(gen), v = vertex(gen);
+        edges.emplace_back(u, v, base(gen) + vertices[u] - vertices[v]);
+    }
+
+    return G{vertices.begin(), vertices.end(), edges.begin(), edges.end()};
+}
+
+// returns time of a run from the virtual source in milliseconds
+template<typename Mode>
+double measure(const G &g, long long &checksum, Mode mode = {})
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    const graphs::Bellman_Ford<G, graphs::graph_traits<G>, Mode>
+        bellman_ford{g, graphs::virtual_source{}, mode};
+    auto finish = std::chrono::high_resolution_clock::now();
+
+    for (auto d : bellman_ford.distances())
+        checksum += *d;
+
+    return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+} // unnamed namespace
+
+// Compares modes of Bellman-Ford algorithm run from the virtual source (as in Johnson's algorithm)
+// on a random graph with negative weights but without negative weight cycles
+int main(int argc, char *argv[])
+{
+    po::options_description extra;
+    extra.add_options()
+        ("threads", po::value<unsigned>()->default_value(0),
+         "set the number of threads of parallel_rounds (0 stands for all hardware threads)");
+
+    const Random_Graph_Options opts{argc, argv, extra, 100'000, 500'000};
+    if (opts.help())
+        return 0;
+
+    std::mt19937_64 gen{42};
+    const G g = generate_graph(opts, gen);
+
+    long long rounds = 0, fifo = 0, slf = 0, parallel = 0;
+    const graphs::parallel_rounds parallel_mode{opts.get<unsigned>("threads")};
+
+    std::cout << "V = " << g.n_vertices() << ", E = " << g.n_edges() << ":\n"
+              << "    rounds:          " << measure<graphs::rounds>(g, rounds) << " ms\n"
+              << "    fifo_queue:      " << measure<graphs::fifo_queue>(g, fifo) << " ms\n"
+              << "    slf_queue:       " << measure<graphs::slf_queue>(g, slf) << " ms\n"
+              << "    parallel_rounds: " << measure(g, parallel, parallel_mode) << " ms"
+              << std::endl;
+
+    if (fifo != rounds || slf != rounds || parallel != rounds)
+    {
+        std::cerr << "Distances differ" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
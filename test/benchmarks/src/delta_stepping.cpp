@@ -0,0 +1,94 @@
+#include <iostream>
+#include <random>
+#include <vector>
+#include <chrono>
+#include <cstddef>
+
+#include "graphs/csr_graph.hpp"
+#include "algorithms/dijkstra.hpp"
+#include "algorithms/delta_stepping.hpp"
+
+#include "random_graph.hpp"
+
+namespace
+{
+
+using G = graphs::CSR_Graph<int>;
+
+// run(s) runs an algorithm from source s and returns the sum of finite distances; returns time
+// per run in milliseconds
+template<typename Run>
+double measure(const std::vector<std::size_t> &sources, long long &checksum, Run run)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    for (auto s : sources)
+        checksum += run(s);
+    auto finish = std::chrono::high_resolution_clock::now();
+
+    return std::chrono::duration<double, std::milli>(finish - start).count() / sources.size();
+}
+
+template<typename Distances>
+long long sum(const Distances &distances)
+{
+    long long result = 0;
+    for (auto d : distances)
+        result += d.is_inf() ? 0 : *d;
+
+    return result;
+}
+
+} // unnamed namespace
+
+// Compares delta-stepping with Dijkstra's algorithm on a random graph
+int main(int argc, char *argv[])
+{
+    po::options_description extra;
+    extra.add_options()
+        ("sources", po::value<std::size_t>()->default_value(10),
+         "set the number of runs of every algorithm (from different sources)")
+        ("delta", po::value<int>()->default_value(10), "set the width of buckets")
+        ("threads", po::value<unsigned>()->default_value(0),
+         "set the number of threads (0 stands for all hardware threads)");
+
+    const Random_Graph_Options opts{argc, argv, extra};
+    if (opts.help())
+        return 0;
+
+    std::mt19937_64 gen{42};
+    const G g = random_graph<G>(opts, gen);
+
+    std::uniform_int_distribution<std::size_t> vertex{0, opts.n_vertices() - 1};
+    std::vector<std::size_t> sources(opts.get<std::size_t>("sources"));
+    for (auto &s : sources)
+        s = vertex(gen);
+
+    const auto delta = opts.get<int>("delta");
+    const auto n_threads = opts.get<unsigned>("threads");
+
+    graphs::Dijkstra<G>::workspace_type dijkstra_ws;
+    graphs::Delta_Stepping<G>::workspace_type delta_stepping_ws;
+    long long dijkstra = 0, delta_stepping = 0;
+
+    const double dijkstra_ms = measure(sources, dijkstra, [&](std::size_t s)
+    {
+        return sum(graphs::Dijkstra{g, s, dijkstra_ws}.distances());
+    });
+
+    const double delta_stepping_ms = measure(sources, delta_stepping, [&](std::size_t s)
+    {
+        return sum(graphs::Delta_Stepping{g, s, delta_stepping_ws, delta, n_threads}.distances());
+    });
+
+    std::cout << "V = " << g.n_vertices() << ", E = " << g.n_edges() << ":\n"
+              << "    Dijkstra:       " << dijkstra_ms << " ms per run\n"
+              << "    Delta_Stepping: " << delta_stepping_ms << " ms per run" << std::endl;
+
+    if (delta_stepping != dijkstra)
+    {
+        std::cerr << "Distances differ" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
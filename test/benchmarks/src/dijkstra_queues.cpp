@@ -0,0 +1,81 @@
+#include <iostream>
+#include <random>
+#include <vector>
+#include <chrono>
+#include <cstddef>
+
+#include "graphs/csr_graph.hpp"
+#include "algorithms/dijkstra.hpp"
+
+#include "random_graph.hpp"
+
+namespace
+{
+
+using G = graphs::CSR_Graph<int>;
+
+// returns time per run in milliseconds
+template<typename Queue>
+double measure(const G &g, const std::vector<std::size_t> &sources, long long &checksum)
+{
+    typename graphs::Dijkstra<G, graphs::graph_traits<G>, Queue>::workspace_type ws;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (auto s : sources)
+    {
+        graphs::Dijkstra<G, graphs::graph_traits<G>, Queue> dijkstra{g, s, ws};
+        for (auto d : dijkstra.distances())
+            checksum += d.is_inf() ? 0 : *d;
+    }
+    auto finish = std::chrono::high_resolution_clock::now();
+
+    return std::chrono::duration<double, std::milli>(finish - start).count() / sources.size();
+}
+
+} // unnamed namespace
+
+// Compares policies of the priority queue of Dijkstra's algorithm on a random graph
+int main(int argc, char *argv[])
+{
+    po::options_description extra;
+    extra.add_options()
+        ("sources", po::value<std::size_t>()->default_value(10),
+         "set the number of runs of Dijkstra's algorithm (from different sources)");
+
+    const Random_Graph_Options opts{argc, argv, extra};
+    if (opts.help())
+        return 0;
+
+    std::mt19937_64 gen{42};
+    const G g = random_graph<G>(opts, gen);
+
+    std::uniform_int_distribution<std::size_t> vertex{0, opts.n_vertices() - 1};
+    std::vector<std::size_t> sources(opts.get<std::size_t>("sources"));
+    for (auto &s : sources)
+        s = vertex(gen);
+
+    long long fibonacci = 0, binary = 0, quaternary = 0, lazy = 0, radix = 0, dial = 0;
+
+    std::cout << "V = " << g.n_vertices() << ", E = " << g.n_edges() << ":\n"
+              << "    fibonacci_heap: "
+              << measure<graphs::fibonacci_heap>(g, sources, fibonacci) << " ms per run\n"
+              << "    d_ary_heap<2>:  "
+              << measure<graphs::d_ary_heap<2>>(g, sources, binary) << " ms per run\n"
+              << "    d_ary_heap<4>:  "
+              << measure<graphs::d_ary_heap<4>>(g, sources, quaternary) << " ms per run\n"
+              << "    lazy_heap:      "
+              << measure<graphs::lazy_heap>(g, sources, lazy) << " ms per run\n"
+              << "    radix_heap:     "
+              << measure<graphs::radix_heap>(g, sources, radix) << " ms per run\n"
+              << "    dial_buckets:   "
+              << measure<graphs::dial_buckets>(g, sources, dial) << " ms per run" << std::endl;
+
+    if (binary != fibonacci || quaternary != fibonacci || lazy != fibonacci ||
+        radix != fibonacci || dial != fibonacci)
+    {
+        std::cerr << "Distances differ" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
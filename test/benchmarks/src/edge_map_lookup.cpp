@@ -0,0 +1,184 @@
+#include <iostream>
+#include <random>
+#include <vector>
+#include <utility>
+#include <unordered_map>
+#include <chrono>
+#include <memory>
+#include <cstddef>
+#include <functional>
+#include <algorithm>
+
+#include <boost/program_options.hpp>
+#include <boost/container_hash/hash.hpp>
+
+#include "utils/edge_map.hpp"
+
+namespace po = boost::program_options;
+
+namespace
+{
+
+class Options
+{
+public:
+
+    Options(int argc, char *argv[])
+    {
+        po::options_description desc{"Allowed options"};
+
+        desc.add_options()
+            ("help", "produce help message")
+            ("max-edges", po::value<std::size_t>()->default_value(10'000'000),
+             "set the number of edges in the largest map")
+            ("lookups", po::value<std::size_t>()->default_value(10'000'000),
+             "set the number of lookups in every map");
+
+        po::variables_map vm;
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        po::notify(vm);
+
+        help_ = vm.count("help");
+        if (help_)
+            std::cout << desc << std::endl;
+
+        max_e_ = vm["max-edges"].as<std::size_t>();
+        n_lookups_ = vm["lookups"].as<std::size_t>();
+    }
+
+    std::size_t max_edges() const noexcept { return max_e_; }
+    std::size_t lookups() const noexcept { return n_lookups_; }
+    bool help() const noexcept { return help_; }
+
+private:
+
+    std::size_t max_e_;
+    std::size_t n_lookups_;
+    bool help_;
+};
+
+std::size_t allocated_bytes = 0;
+
+// counts memory allocated by std::unordered_map
+template<typename T>
+struct Counting_Allocator
+{
+    using value_type = T;
+
+    Counting_Allocator() = default;
+
+    template<typename U>
+    Counting_Allocator(const Counting_Allocator<U> &) noexcept {}
+
+    T *allocate(std::size_t n)
+    {
+        allocated_bytes += n * sizeof(T);
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T *p, std::size_t n) noexcept
+    {
+        allocated_bytes -= n * sizeof(T);
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    template<typename U>
+    bool operator==(const Counting_Allocator<U> &) const noexcept { return true; }
+};
+
+using edge_type = std::pair<std::size_t, std::size_t>;
+
+using Std_Map = std::unordered_map<edge_type, int, boost::hash<edge_type>, std::equal_to<edge_type>,
+                                   Counting_Allocator<std::pair<const edge_type, int>>>;
+
+std::vector<edge_type> generate_edges(std::size_t n_edges, std::mt19937_64 &gen)
+{
+    std::uniform_int_distribution<std::size_t> vertex{0, n_edges / 4};
+
+    std::vector<edge_type> edges;
+    edges.reserve(n_edges);
+
+    for (auto e = 0uz; e != n_edges; ++e)
+        edges.emplace_back(vertex(gen), vertex(gen));
+
+    return edges;
+}
+
+// returns time per lookup in nanoseconds; half of looked up edges are in the map
+template<typename Map>
+double measure_lookups(const Map &map, const std::vector<edge_type> &present,
+                       const std::vector<edge_type> &absent, std::size_t n_lookups)
+{
+    long long sum = 0;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (auto i = 0uz; i != n_lookups; ++i)
+    {
+        const auto &edges = (i % 2 == 0) ? present : absent;
+        const auto &edge = edges[(i / 2) % edges.size()];
+
+        if constexpr (requires { map.find(edge) == map.end(); })
+        {
+            if (auto it = map.find(edge); it != map.end())
+                sum += it->second;
+        }
+        else
+        {
+            if (auto value = map.find(edge))
+                sum += *value;
+        }
+    }
+    auto finish = std::chrono::high_resolution_clock::now();
+
+    if (sum == 42) // prevents optimizing lookups out
+        std::cout << "";
+
+    return std::chrono::duration<double, std::nano>(finish - start).count() / n_lookups;
+}
+
+} // unnamed namespace
+
+// Compares lookup time and memory per entry of graphs::Edge_Map and std::unordered_map with
+// boost::hash for maps of growing size
+int main(int argc, char *argv[])
+{
+    Options opts{argc, argv};
+    if (opts.help())
+        return 0;
+
+    std::mt19937_64 gen{42};
+
+    for (auto n_edges = 1'000uz; n_edges <= opts.max_edges(); n_edges *= 10)
+    {
+        auto present = generate_edges(n_edges, gen);
+        auto absent = generate_edges(n_edges, gen);
+        for (auto &edge : absent)
+            edge.first += n_edges; // no such tails among present edges
+
+        graphs::Edge_Map<int> edge_map;
+        Std_Map std_map;
+
+        for (auto i = 0uz; i != n_edges; ++i)
+        {
+            edge_map.emplace(present[i], static_cast<int>(i));
+            std_map.emplace(present[i], static_cast<int>(i));
+        }
+
+        std::shuffle(present.begin(), present.end(), gen);
+
+        const auto edge_map_time = measure_lookups(edge_map, present, absent, opts.lookups());
+        const auto std_map_time = measure_lookups(std_map, present, absent, opts.lookups());
+
+        std::cout << "E = " << edge_map.size() << ":\n"
+                  << "    Edge_Map:           "
+                  << edge_map_time << " ns per lookup, "
+                  << static_cast<double>(edge_map.memory_usage()) / edge_map.size()
+                  << " bytes per entry\n"
+                  << "    std::unordered_map: "
+                  << std_map_time << " ns per lookup, "
+                  << static_cast<double>(allocated_bytes) / std_map.size()
+                  << " bytes per entry" << std::endl;
+    }
+
+    return 0;
+}
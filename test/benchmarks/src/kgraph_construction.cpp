@@ -0,0 +1,111 @@
+#include <iostream>
+#include <random>
+#include <vector>
+#include <tuple>
+#include <chrono>
+#include <stdexcept>
+#include <cstddef>
+#include <algorithm>
+
+#include <boost/program_options.hpp>
+
+#include "graphs/kgraph.hpp"
+
+namespace po = boost::program_options;
+
+namespace
+{
+
+class Options
+{
+public:
+
+    Options(int argc, char *argv[])
+    {
+        po::options_description desc{"Allowed options"};
+
+        desc.add_options()
+            ("help", "produce help message")
+            ("max-edges", po::value<std::size_t>()->default_value(10'000'000),
+             "set the number of edges in the largest graph")
+            ("edges-per-vertex", po::value<std::size_t>()->default_value(8),
+             "set the average number of edges incident on a vertex")
+            ("sorted-dedup", "deduplicate edges by parallel sorting instead of hashing");
+
+        po::variables_map vm;
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        po::notify(vm);
+
+        help_ = vm.count("help");
+        if (help_)
+            std::cout << desc << std::endl;
+
+        max_e_ = vm["max-edges"].as<std::size_t>();
+        ratio_ = vm["edges-per-vertex"].as<std::size_t>();
+        sorted_dedup_ = vm.count("sorted-dedup");
+        if (ratio_ == 0)
+            throw std::runtime_error{"The number of edges per vertex must be a positive number"};
+    }
+
+    std::size_t max_edges() const noexcept { return max_e_; }
+    std::size_t edges_per_vertex() const noexcept { return ratio_; }
+    bool sorted_dedup() const noexcept { return sorted_dedup_; }
+    bool help() const noexcept { return help_; }
+
+private:
+
+    std::size_t max_e_;
+    std::size_t ratio_;
+    bool sorted_dedup_;
+    bool help_;
+};
+
+std::vector<std::tuple<int, int, int>> generate_edges(std::size_t n_edges, std::size_t ratio)
+{
+    const auto n_vertices = static_cast<int>(std::max(n_edges * 2 / ratio, std::size_t{2}));
+
+    std::mt19937_64 gen{42};
+    std::uniform_int_distribution<int> vertex{0, n_vertices - 1};
+    std::uniform_int_distribution<int> weight{0, 100};
+
+    std::vector<std::tuple<int, int, int>> edges;
+    edges.reserve(n_edges);
+
+    for (auto e = 0uz; e != n_edges; ++e)
+        edges.emplace_back(vertex(gen), vertex(gen), weight(gen));
+
+    return edges;
+}
+
+} // unnamed namespace
+
+// Constructs KGraph from random edge lists of growing size. If construction is linear, time per
+// edge stays (roughly) the same for all sizes.
+int main(int argc, char *argv[])
+{
+    Options opts{argc, argv};
+    if (opts.help())
+        return 0;
+
+    using ms = std::chrono::milliseconds;
+    using ns = std::chrono::nanoseconds;
+
+    for (auto n_edges = 1'000uz; n_edges <= opts.max_edges(); n_edges *= 10)
+    {
+        auto edges = generate_edges(n_edges, opts.edges_per_vertex());
+
+        auto start = std::chrono::high_resolution_clock::now();
+        auto g = opts.sorted_dedup() ? graphs::KGraph(edges.begin(), edges.end(),
+                                                      graphs::sorted_dedup{})
+                                     : graphs::KGraph(edges.begin(), edges.end());
+        auto finish = std::chrono::high_resolution_clock::now();
+
+        auto time = finish - start;
+        std::cout << "E = " << n_edges << " (V = " << g.n_vertices() << "): "
+                  << std::chrono::duration_cast<ms>(time).count() << " ms, "
+                  << std::chrono::duration_cast<ns>(time).count() / n_edges << " ns per edge"
+                  << std::endl;
+    }
+
+    return 0;
+}
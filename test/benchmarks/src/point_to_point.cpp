@@ -0,0 +1,114 @@
+#include <iostream>
+#include <random>
+#include <vector>
+#include <utility>
+#include <chrono>
+#include <cstddef>
+
+#include "graphs/directed_graph.hpp"
+#include "algorithms/dijkstra.hpp"
+#include "algorithms/bidirectional_dijkstra.hpp"
+
+#include "random_graph.hpp"
+
+namespace
+{
+
+using G = graphs::Directed_Graph<int>;
+using query_type = std::pair<std::size_t, std::size_t>;
+
+struct Result final
+{
+    double ms_per_query;
+    double touched_per_query;
+    long long checksum;
+};
+
+// run(s, t) returns the distance from s to t and the number of touched vertices
+template<typename Run>
+Result measure(const std::vector<query_type> &queries, Run run)
+{
+    Result result{};
+    std::size_t touched = 0;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (auto [s, t] : queries)
+    {
+        auto [d, n_touched] = run(s, t);
+        result.checksum += d.is_inf() ? -1 : *d;
+        touched += n_touched;
+    }
+    auto finish = std::chrono::high_resolution_clock::now();
+
+    result.ms_per_query =
+        std::chrono::duration<double, std::milli>(finish - start).count() / queries.size();
+    result.touched_per_query = static_cast<double>(touched) / queries.size();
+
+    return result;
+}
+
+void print(const char *name, const Result &result)
+{
+    std::cout << "    " << name << result.ms_per_query << " ms, "
+              << result.touched_per_query << " touched vertices per query\n";
+}
+
+} // unnamed namespace
+
+// Compares single-pair queries answered by full Dijkstra's algorithm, by Dijkstra's algorithm
+// which stops at the target and by bidirectional Dijkstra's algorithm
+int main(int argc, char *argv[])
+{
+    po::options_description extra;
+    extra.add_options()
+        ("queries", po::value<std::size_t>()->default_value(20),
+         "set the number of (source, target) pairs");
+
+    const Random_Graph_Options opts{argc, argv, extra};
+    if (opts.help())
+        return 0;
+
+    std::mt19937_64 gen{42};
+    const G g = random_graph<G>(opts, gen);
+
+    std::uniform_int_distribution<std::size_t> vertex{0, opts.n_vertices() - 1};
+    std::vector<query_type> queries(opts.get<std::size_t>("queries"));
+    for (auto &query : queries)
+        query = {vertex(gen), vertex(gen)};
+
+    graphs::Dijkstra<G>::workspace_type ws;
+    graphs::Bidirectional_Dijkstra<G>::workspace_type forward_ws, backward_ws;
+
+    auto full = measure(queries, [&](std::size_t s, std::size_t t)
+    {
+        graphs::Dijkstra dijkstra{g, s, ws};
+        return std::pair{dijkstra.distance(t), ws.touched().size()};
+    });
+
+    auto target = measure(queries, [&](std::size_t s, std::size_t t)
+    {
+        graphs::Dijkstra dijkstra{g, s, t, ws};
+        return std::pair{dijkstra.distance(t), ws.touched().size()};
+    });
+
+    auto bidirectional = measure(queries, [&](std::size_t s, std::size_t t)
+    {
+        graphs::Bidirectional_Dijkstra dijkstra{g, s, t, forward_ws, backward_ws};
+        return std::pair{dijkstra.distance(),
+                         forward_ws.touched().size() + backward_ws.touched().size()};
+    });
+
+    std::cout << "V = " << g.n_vertices() << ", E = " << g.n_edges() << ":\n";
+    print("Dijkstra:               ", full);
+    print("Dijkstra with target:   ", target);
+    print("Bidirectional_Dijkstra: ", bidirectional);
+    std::cout.flush();
+
+    if (target.checksum != full.checksum || bidirectional.checksum != full.checksum)
+    {
+        std::cerr << "Distances differ" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
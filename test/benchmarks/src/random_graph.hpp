@@ -0,0 +1,102 @@
+#ifndef TEST_BENCHMARKS_SRC_RANDOM_GRAPH_HPP
+#define TEST_BENCHMARKS_SRC_RANDOM_GRAPH_HPP
+
+#include <iostream>
+#include <random>
+#include <vector>
+#include <tuple>
+#include <numeric>
+#include <cstddef>
+#include <cstdlib>
+#include <concepts>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+
+// Options of benchmarks on random graphs: --n-vertices, --n-edges and --max-weight-modulo are
+// common to all of them; options of a particular benchmark are described by extra, and their
+// values are available through get()
+class Random_Graph_Options
+{
+public:
+
+    Random_Graph_Options(int argc, char *argv[], const po::options_description &extra,
+                         std::size_t default_n_vertices = 1'000'000,
+                         std::size_t default_n_edges = 5'000'000)
+    {
+        po::options_description desc{"Allowed options"};
+
+        desc.add_options()
+            ("help", "produce help message")
+            ("n-vertices", po::value<std::size_t>()->default_value(default_n_vertices),
+             "set the number of vertices")
+            ("n-edges", po::value<std::size_t>()->default_value(default_n_edges),
+             "set the number of edges")
+            ("max-weight-modulo", po::value<int>()->default_value(20),
+             "set the maximal weight modulo");
+        desc.add(extra);
+
+        po::store(po::parse_command_line(argc, argv, desc), vm_);
+        po::notify(vm_);
+
+        help_ = vm_.count("help");
+        if (help_)
+            std::cout << desc << std::endl;
+
+        v_ = vm_["n-vertices"].as<std::size_t>();
+        e_ = vm_["n-edges"].as<std::size_t>();
+        max_w_ = vm_["max-weight-modulo"].as<int>();
+    }
+
+    std::size_t n_vertices() const noexcept { return v_; }
+    std::size_t n_edges() const noexcept { return e_; }
+    int max_weight_modulo() const noexcept { return max_w_; }
+    bool help() const noexcept { return help_; }
+
+    template<typename T>
+    T get(const char *name) const { return vm_[name].as<T>(); }
+
+private:
+
+    po::variables_map vm_;
+    std::size_t v_;
+    std::size_t e_;
+    int max_w_;
+    bool help_;
+};
+
+// Random graph like the ones made by the generator target except that weights are absolute values
+// of the generated ones since not all algorithms accept negative weights. Vertex i is i. G is
+// either constructed from ranges of vertices and edges or built by insertions
+template<typename G>
+G random_graph(const Random_Graph_Options &opts, std::mt19937_64 &gen)
+{
+    std::uniform_int_distribution<std::size_t> vertex{0, opts.n_vertices() - 1};
+    std::uniform_int_distribution<int> weight{-opts.max_weight_modulo(), opts.max_weight_modulo()};
+
+    std::vector<int> vertices(opts.n_vertices());
+    std::iota(vertices.begin(), vertices.end(), 0);
+
+    std::vector<std::tuple<std::size_t, std::size_t, int>> edges;
+    edges.reserve(opts.n_edges());
+
+    for (auto e = 0uz; e != opts.n_edges(); ++e)
+        edges.emplace_back(vertex(gen), vertex(gen), std::abs(weight(gen)));
+
+    using vertex_it = typename std::vector<int>::iterator;
+    using edge_it = typename decltype(edges)::iterator;
+
+    if constexpr (std::constructible_from<G, vertex_it, vertex_it, edge_it, edge_it>)
+        return G{vertices.begin(), vertices.end(), edges.begin(), edges.end()};
+    else
+    {
+        G g{vertices.begin(), vertices.end()};
+        for (const auto &[from, to, w] : edges)
+            g.insert_edge(from, to, w);
+
+        return g;
+    }
+}
+
+#endif // TEST_BENCHMARKS_SRC_RANDOM_GRAPH_HPP
@@ -2,6 +2,7 @@
 #include <stdexcept>
 #include <limits>
 #include <unordered_map>
+#include <unordered_set>
 #include <chrono>
 
 #include "graphs/directed_graph.hpp"
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <ranges>
+#include <vector>
+#include <cstddef>
+#include <cstdlib>
+
+#include "graphs/directed_graph.hpp"
+#include "algorithms/dijkstra.hpp"
+#include "algorithms/a_star.hpp"
+
+namespace
+{
+
+constexpr std::size_t side = 60;
+constexpr int min_weight = 5;
+
+using G = graphs::Directed_Graph<int>;
+
+// side x side grid with edges in both directions between neighbours and weights in
+// [min_weight, 2 * min_weight]
+G grid()
+{
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<int> weight{min_weight, 2 * min_weight};
+
+    G g;
+    for (auto v : std::views::iota(0uz, side * side))
+        g.insert_vertex(static_cast<int>(v));
+
+    for (auto row : std::views::iota(0uz, side))
+    {
+        for (auto col : std::views::iota(0uz, side))
+        {
+            const std::size_t v = row * side + col;
+
+            if (col + 1 != side)
+            {
+                const int w = weight(gen);
+                g.insert_edge(v, v + 1, w);
+                g.insert_edge(v + 1, v, w);
+            }
+
+            if (row + 1 != side)
+            {
+                const int w = weight(gen);
+                g.insert_edge(v, v + side, w);
+                g.insert_edge(v + side, v, w);
+            }
+        }
+    }
+
+    return g;
+}
+
+// Manhattan distance to the target times the least weight, which is consistent
+struct Manhattan final
+{
+    std::size_t target;
+
+    int operator()(std::size_t v) const
+    {
+        const auto row = static_cast<int>(v / side), col = static_cast<int>(v % side);
+        const auto t_row = static_cast<int>(target / side), t_col = static_cast<int>(target % side);
+
+        return min_weight * (std::abs(row - t_row) + std::abs(col - t_col));
+    }
+};
+
+} // unnamed namespace
+
+// Example from "Introduction to Algorithms" by Thomas H. Cormen and others
+TEST(A_Star, Zero_Heuristic)
+{
+    enum : std::size_t { s, t, x, y, z };
+
+    graphs::Directed_Graph<char> g{'s', 't', 'x', 'y', 'z'};
+    g.insert_edges({{s, t, 10}, {s, y, 5}, {t, x, 1}, {t, y, 2}, {x, z, 4},
+                    {y, t, 3}, {y, x, 9}, {y, z, 2}, {z, s, 7}, {z, x, 6}});
+
+    auto zero = [](std::size_t){ return 0; };
+
+    graphs::A_Star s_x{g, s, x, zero};
+    EXPECT_EQ(s_x.distance(x), 9);
+    EXPECT_EQ(s_x.path_to(x), (std::vector<std::size_t>{s, y, t, x}));
+
+    graphs::A_Star x_t{g, x, t, zero};
+    EXPECT_EQ(x_t.distance(t), 19);
+    EXPECT_EQ(x_t.path_to(t), (std::vector<std::size_t>{x, z, s, y, t}));
+
+    EXPECT_THROW((graphs::A_Star{g, s, 5, zero}), std::out_of_range);
+}
+
+TEST(A_Star, Grid)
+{
+    const G g = grid();
+
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<std::size_t> vertex{0, side * side - 1};
+
+    graphs::Dijkstra<G>::workspace_type dijkstra_ws;
+    graphs::A_Star<G, Manhattan>::workspace_type a_star_ws;
+    std::size_t dijkstra_touched = 0, a_star_touched = 0;
+
+    for (auto _ : std::views::iota(0, 20))
+    {
+        const auto s = vertex(gen);
+        const auto t = vertex(gen);
+
+        graphs::Dijkstra dijkstra{g, s, t, dijkstra_ws};
+        graphs::A_Star a_star{g, s, t, Manhattan{t}, a_star_ws};
+
+        ASSERT_EQ(a_star.distance(t), dijkstra.distance(t));
+
+        auto path = a_star.path_to(t);
+        ASSERT_EQ(path.front(), s);
+        ASSERT_EQ(path.back(), t);
+
+        // settled vertices have exact distances with a consistent heuristic
+        graphs::Dijkstra from_s{g, s};
+        for (auto v : a_star_ws.touched())
+        {
+            if (a_star_ws.marked(v))
+            {
+                ASSERT_EQ(a_star_ws.distance(v), from_s.distance(v));
+            }
+        }
+
+        dijkstra_touched += dijkstra_ws.touched().size();
+        a_star_touched += a_star_ws.touched().size();
+    }
+
+    EXPECT_LT(2 * a_star_touched, dijkstra_touched);
+}
+
+TEST(A_Star, Inconsistent_Heuristic)
+{
+    const G g = grid();
+
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<std::size_t> vertex{0, side * side - 1};
+
+    for (auto _ : std::views::iota(0, 20))
+    {
+        const auto s = vertex(gen);
+        const auto t = vertex(gen);
+
+        // Random fractions of exact distances to the target (the grid is symmetric) never
+        // overestimate but jump between neighbours
+
+        graphs::Dijkstra from_t{g, t};
+        std::uniform_int_distribution<int> percent{0, 100};
+
+        std::vector<int> h(side * side);
+        for (auto v : std::views::iota(0uz, h.size()))
+            h[v] = *from_t.distance(v) * percent(gen) / 100;
+
+        auto heuristic = [&h](std::size_t v){ return h[v]; };
+
+        // the default queue must accept keys less than the last popped one
+        graphs::A_Star defaulted{g, s, t, heuristic};
+        graphs::A_Star<G, decltype(heuristic), graphs::graph_traits<G>, graphs::lazy_heap>
+            lazy{g, s, t, heuristic};
+
+        ASSERT_EQ(defaulted.distance(t), from_t.distance(s));
+        ASSERT_EQ(lazy.distance(t), from_t.distance(s));
+    }
+}
@@ -4,6 +4,10 @@
 #include <vector>
 #include <unordered_map>
 #include <initializer_list>
+#include <random>
+#include <ranges>
+#include <limits>
+#include <cstddef>
 
 #include "graphs/directed_graph.hpp"
 #include "algorithms/bellman_ford.hpp"
@@ -132,3 +136,201 @@ TEST(Bellman_Ford, Negative_Weights)
     for (auto v : vertices)
         EXPECT_EQ(sssp.distance(it.at(v)), distance.at(v));
 }
+
+namespace
+{
+
+using Random_Graph = graphs::Directed_Graph<int>;
+
+// Random graph with weights w(u, v) = base(u, v) + p(u) - p(v), where base weights are
+// non-negative, so the weights are negative quite often but there are no negative weight cycles.
+// Then n_negative_edges edges with large negative weights are added
+Random_Graph random_graph(std::size_t n_vertices, std::size_t n_edges,
+                          std::size_t n_negative_edges, std::mt19937 &gen)
+{
+    std::uniform_int_distribution<std::size_t> vertex{0, n_vertices - 1};
+    std::uniform_int_distribution<int> base{0, 20};
+    std::uniform_int_distribution<int> potential{-50, 50};
+
+    Random_Graph g;
+    std::vector<int> p(n_vertices);
+    for (auto v : std::views::iota(0uz, n_vertices))
+    {
+        g.insert_vertex(static_cast<int>(v));
+        p[v] = potential(gen);
+    }
+
+    for (auto _ : std::views::iota(0uz, n_edges))
+    {
+        const auto u = vertex(gen), v = vertex(gen);
+        g.insert_edge(u, v, base(gen) + p[u] - p[v]);
+    }
+
+    for (auto _ : std::views::iota(0uz, n_negative_edges))
+        g.insert_edge(vertex(gen), vertex(gen), -1'000);
+
+    return g;
+}
+
+// the weight of the lightest edge from u to v
+int min_weight(const Random_Graph &g, std::size_t u, std::size_t v)
+{
+    int w_min = std::numeric_limits<int>::max();
+    for (auto [i, w] : graphs::adjacent_edges<graphs::graph_traits<Random_Graph>>(g, u))
+    {
+        if (i == v)
+            w_min = std::min(w_min, w);
+    }
+
+    return w_min;
+}
+
+template<typename Mode>
+void expect_negative_cycle(const Random_Graph &g, const graphs::Bellman_Ford<
+                               Random_Graph, graphs::graph_traits<Random_Graph>, Mode> &sssp)
+{
+    const auto cycle = sssp.negative_cycle();
+    ASSERT_FALSE(cycle.empty());
+    EXPECT_TRUE(sssp.distances().empty());
+
+    long long weight = 0;
+    for (auto i : std::views::iota(0uz, cycle.size()))
+    {
+        const int w = min_weight(g, cycle[i], cycle[(i + 1) % cycle.size()]);
+        ASSERT_NE(w, std::numeric_limits<int>::max()); // there is an edge
+        weight += w;
+    }
+
+    EXPECT_LT(weight, 0);
+}
+
+} // unnamed namespace
+
+TEST(Bellman_Ford, Negative_Cycle)
+{
+    Random_Graph g{'s', 't', 'x', 'y', 'z'};
+    g.insert_edges({{0, 1, 6}, {0, 3, 7}, {1, 2, 5}, {1, 3, 8}, {1, 4, -4},
+                    {2, 1, -6}, {3, 2, -3}, {3, 4, 9}, {4, 0, 2}, {4, 2, 7}});
+
+    auto check = [&g]<typename Mode>(Mode)
+    {
+        using traits = graphs::graph_traits<Random_Graph>;
+
+        const graphs::Bellman_Ford<Random_Graph, traits, Mode> sssp{g, 0};
+        EXPECT_TRUE(sssp.has_negative_weight_cycles());
+        expect_negative_cycle(g, sssp);
+
+        const graphs::Bellman_Ford<Random_Graph, traits, Mode> all{g, graphs::virtual_source{}};
+        expect_negative_cycle(g, all);
+    };
+
+    check(graphs::rounds{});
+    check(graphs::fifo_queue{});
+    check(graphs::slf_queue{});
+    check(graphs::parallel_rounds{});
+
+    // a negative self-loop
+    Random_Graph loop{'a'};
+    loop.insert_edge(0, 0, -1);
+
+    const graphs::Bellman_Ford sssp{loop, 0};
+    EXPECT_EQ(std::vector(sssp.negative_cycle().begin(), sssp.negative_cycle().end()),
+              std::vector<std::size_t>{0});
+}
+
+TEST(Bellman_Ford, Modes)
+{
+    using traits = graphs::graph_traits<Random_Graph>;
+
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<std::size_t> vertex{0, 299};
+
+    for (auto _ : std::views::iota(0, 10))
+    {
+        const Random_Graph g = random_graph(300, 1'500, 0, gen);
+        const auto s = vertex(gen);
+
+        const graphs::Bellman_Ford<Random_Graph, traits, graphs::rounds> rounds{g, s};
+        const graphs::Bellman_Ford<Random_Graph, traits, graphs::fifo_queue> fifo{g, s};
+        const graphs::Bellman_Ford<Random_Graph, traits, graphs::slf_queue> slf{g, s};
+
+        ASSERT_TRUE(rounds);
+        ASSERT_TRUE(fifo);
+        ASSERT_TRUE(slf);
+
+        EXPECT_TRUE(std::ranges::equal(rounds.distances(), fifo.distances()));
+        EXPECT_TRUE(std::ranges::equal(rounds.distances(), slf.distances()));
+
+        for (auto v : std::views::iota(0uz, g.n_vertices()))
+        {
+            const auto path = slf.path_to(v);
+            if (path.empty())
+                continue;
+
+            int weight = 0;
+            for (auto i : std::views::iota(1uz, path.size()))
+                weight += min_weight(g, path[i - 1], path[i]);
+
+            EXPECT_EQ(slf.distance(v), weight);
+        }
+
+        const graphs::Bellman_Ford<Random_Graph, traits, graphs::rounds>
+            all_rounds{g, graphs::virtual_source{}};
+        const graphs::Bellman_Ford<Random_Graph, traits, graphs::fifo_queue>
+            all_fifo{g, graphs::virtual_source{}};
+
+        EXPECT_TRUE(std::ranges::equal(all_rounds.distances(), all_fifo.distances()));
+    }
+
+    for (auto _ : std::views::iota(0, 10))
+    {
+        const Random_Graph g = random_graph(300, 1'500, 5, gen);
+
+        expect_negative_cycle(g, graphs::Bellman_Ford<Random_Graph, traits, graphs::rounds>{
+                                     g, graphs::virtual_source{}});
+        expect_negative_cycle(g, graphs::Bellman_Ford<Random_Graph, traits, graphs::fifo_queue>{
+                                     g, graphs::virtual_source{}});
+        expect_negative_cycle(g, graphs::Bellman_Ford<Random_Graph, traits, graphs::slf_queue>{
+                                     g, graphs::virtual_source{}});
+    }
+}
+
+TEST(Bellman_Ford, Parallel_Rounds)
+{
+    using traits = graphs::graph_traits<Random_Graph>;
+
+    // large enough for 4 threads
+
+    std::mt19937 gen{42};
+    const Random_Graph g = random_graph(50'000, 250'000, 0, gen);
+
+    const graphs::Bellman_Ford<Random_Graph, traits, graphs::fifo_queue> fifo{g, 0};
+    const graphs::Bellman_Ford parallel{g, 0, graphs::parallel_rounds{4}};
+
+    ASSERT_TRUE(parallel);
+    EXPECT_TRUE(std::ranges::equal(fifo.distances(), parallel.distances()));
+
+    for (auto v : std::views::iota(0uz, g.n_vertices()))
+    {
+        const auto path = parallel.path_to(v);
+        if (path.empty())
+            continue;
+
+        int weight = 0;
+        for (auto i : std::views::iota(1uz, path.size()))
+            weight += min_weight(g, path[i - 1], path[i]);
+
+        ASSERT_EQ(parallel.distance(v), weight);
+    }
+
+    const graphs::Bellman_Ford<Random_Graph, traits, graphs::fifo_queue>
+        all_fifo{g, graphs::virtual_source{}};
+    const graphs::Bellman_Ford all_parallel{g, graphs::virtual_source{},
+                                            graphs::parallel_rounds{4}};
+
+    EXPECT_TRUE(std::ranges::equal(all_fifo.distances(), all_parallel.distances()));
+
+    const Random_Graph negative = random_graph(50'000, 250'000, 5, gen);
+    expect_negative_cycle(negative, graphs::Bellman_Ford{negative, graphs::virtual_source{},
+                                                         graphs::parallel_rounds{4}});
+}
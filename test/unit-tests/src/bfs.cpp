@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <vector>
+
 #include "algorithms/bfs.hpp"
+#include "algorithms/dfs.hpp"
 #include "graphs/directed_graph.hpp"
 #include "graphs/kgraph.hpp"
 
@@ -76,3 +80,29 @@ TEST(BFS, KGraph)
     for (auto v : vertices)
         EXPECT_EQ(bfs.distance(g.find_vertex(v).value()), distance.at(v));
 }
+
+TEST(BFS, Result_Spans)
+{
+    using G = graphs::Directed_Graph<char>;
+    using distance_type = graphs::BFS<G>::distance_type;
+
+    G g{'a', 'b', 'c', 'd'};
+    g.insert_edges({{0, 1}, {1, 2}, {0, 2}});
+
+    graphs::BFS bfs{g, 0};
+
+    EXPECT_TRUE(std::ranges::equal(bfs.distances(), std::vector<distance_type>{
+                                       0uz, 1uz, 1uz, distance_type{}}));
+    EXPECT_TRUE(std::ranges::equal(bfs.predecessors(), std::vector{bfs.nil, 0uz, 0uz, bfs.nil}));
+    EXPECT_EQ(bfs.path_to(2), (std::vector{0uz, 2uz}));
+    EXPECT_TRUE(bfs.path_to(3).empty());
+
+    graphs::DFS dfs{g, graphs::recursive{}};
+
+    EXPECT_EQ(dfs.discovery_times().size(), g.n_vertices());
+    EXPECT_EQ(dfs.finished_times().size(), g.n_vertices());
+    EXPECT_EQ(dfs.discovery_time(3), 7);
+    EXPECT_EQ(dfs.finished_time(3), 8);
+    EXPECT_EQ(dfs.predecessor(0), dfs.nil);
+    EXPECT_EQ(dfs.predecessor(3), dfs.nil);
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <ranges>
+#include <cstddef>
+
+#include "graphs/directed_graph.hpp"
+#include "algorithms/dijkstra.hpp"
+#include "algorithms/bidirectional_dijkstra.hpp"
+
+// Example from "Introduction to Algorithms" by Thomas H. Cormen and others
+TEST(Bidirectional_Dijkstra, Cormen)
+{
+    enum : std::size_t { s, t, x, y, z };
+
+    graphs::Directed_Graph<char> g{'s', 't', 'x', 'y', 'z'};
+    g.insert_edges({{s, t, 10}, {s, y, 5}, {t, x, 1}, {t, y, 2}, {x, z, 4},
+                    {y, t, 3}, {y, x, 9}, {y, z, 2}, {z, s, 7}, {z, x, 6}});
+
+    graphs::Bidirectional_Dijkstra s_x{g, s, x};
+    EXPECT_EQ(s_x.distance(), 9);
+    EXPECT_EQ(s_x.path(), (std::vector<std::size_t>{s, y, t, x}));
+
+    graphs::Bidirectional_Dijkstra x_t{g, x, t};
+    EXPECT_EQ(x_t.distance(), 19);
+    EXPECT_EQ(x_t.path(), (std::vector<std::size_t>{x, z, s, y, t}));
+
+    graphs::Bidirectional_Dijkstra y_y{g, y, y};
+    EXPECT_EQ(y_y.distance(), 0);
+    EXPECT_EQ(y_y.path(), std::vector<std::size_t>{y});
+
+    g.insert_vertex('w');
+
+    graphs::Bidirectional_Dijkstra s_w{g, s, 5};
+    EXPECT_TRUE(s_w.distance().is_inf());
+    EXPECT_TRUE(s_w.path().empty());
+}
+
+TEST(Bidirectional_Dijkstra, Against_Dijkstra)
+{
+    using G = graphs::Directed_Graph<int>;
+
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<std::size_t> vertex{0, 499};
+    std::uniform_int_distribution<int> weight{0, 20};
+
+    G g;
+    for (auto v : std::views::iota(0, 500))
+        g.insert_vertex(v);
+    for (auto _ : std::views::iota(0, 2'000))
+        g.insert_edge(vertex(gen), vertex(gen), weight(gen));
+
+    graphs::Bidirectional_Dijkstra<G>::workspace_type forward, backward;
+
+    for (auto _ : std::views::iota(0, 50))
+    {
+        const auto s = vertex(gen);
+        const auto t = vertex(gen);
+
+        graphs::Dijkstra dijkstra{g, s};
+        graphs::Bidirectional_Dijkstra bidirectional{g, s, t, forward, backward};
+
+        EXPECT_EQ(bidirectional.distance(), dijkstra.distance(t));
+
+        // the path is a shortest one, but it may differ from the one found by Dijkstra
+        auto path = bidirectional.path();
+        if (dijkstra.distance(t).is_inf())
+            EXPECT_TRUE(path.empty());
+        else
+        {
+            EXPECT_EQ(path.front(), s);
+            EXPECT_EQ(path.back(), t);
+
+            int length = 0;
+            for (auto i : std::views::iota(1uz, path.size()))
+                length += g.weight(path[i - 1], path[i]);
+            EXPECT_EQ(length, *dijkstra.distance(t));
+        }
+    }
+}
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+#include <tuple>
+#include <stdexcept>
+#include <type_traits>
+
+#include "graphs/directed_graph.hpp"
+#include "graphs/csr_graph.hpp"
+#include "algorithms/bfs.hpp"
+#include "algorithms/dfs.hpp"
+#include "algorithms/dijkstra.hpp"
+#include "algorithms/bellman_ford.hpp"
+
+TEST(CSR_Graph, Default_Constructor)
+{
+    graphs::CSR_Graph<int> g;
+
+    EXPECT_TRUE(g.empty());
+    EXPECT_EQ(g.n_vertices(), 0);
+    EXPECT_EQ(g.n_edges(), 0);
+}
+
+/*
+ * 1 ---> 2 ---> 3
+ * |             ^
+ * +-------------+
+ */
+TEST(CSR_Graph, Edge_List_Constructor)
+{
+    std::vector vertices{1, 2, 3};
+    std::vector edges{std::tuple{0uz, 2uz, 5},
+                      std::tuple{0uz, 1uz, 4},
+                      std::tuple{1uz, 2uz, 6},
+                      std::tuple{0uz, 1uz, 8}}; // duplicates are ignored
+
+    graphs::CSR_Graph g(vertices.begin(), vertices.end(), edges.begin(), edges.end());
+    static_assert(std::is_same_v<decltype(g)::vertex_type, int>);
+
+    EXPECT_EQ(g.n_vertices(), 3);
+    EXPECT_EQ(g.n_edges(), 3);
+    EXPECT_TRUE(std::ranges::equal(g, vertices));
+
+    EXPECT_TRUE(std::ranges::equal(g.adjacent_vertices(0), std::vector{1uz, 2uz}));
+    EXPECT_TRUE(std::ranges::equal(g.adjacent_weights(0), std::vector{4, 5}));
+    EXPECT_TRUE(std::ranges::equal(g.adjacent_vertices(1), std::vector{2uz}));
+    EXPECT_TRUE(g.adjacent_vertices(2).empty());
+
+    EXPECT_EQ(g.weight(0, 1), 4);
+    EXPECT_EQ(g.weight(0, 2), 5);
+    EXPECT_EQ(g.weight(1, 2), 6);
+    EXPECT_THROW(g.weight(2, 0), std::out_of_range);
+
+    EXPECT_EQ(g.vertex_in_degree(0), 0);
+    EXPECT_EQ(g.vertex_in_degree(2), 2); // the duplicate isn't counted
+    EXPECT_EQ(g.vertex_degree(1), 2);
+
+    graphs::CSR_Graph<int> g2{{1, 2}, {{0, 1}, {1, 0}}};
+    EXPECT_EQ(g2.n_edges(), 2);
+    EXPECT_EQ(g2.weight(0, 1), graphs::CSR_Graph<int>::default_weight);
+
+    EXPECT_THROW((graphs::CSR_Graph<int>{{1, 2}, {{0, 2}}}), std::out_of_range);
+}
+
+/*
+ *   +------> 3
+ *   |        ^
+ *   |        |
+ *   |    +-- 2 --+
+ *   |    |       |
+ *   1 <--+       +--> 4
+ */
+TEST(CSR_Graph, Freeze_Directed_Graph)
+{
+    graphs::Directed_Graph<int> dg;
+    auto i_1 = dg.insert_vertex(1);
+    auto i_2 = dg.insert_vertex(2);
+    auto i_3 = dg.insert_vertex(3);
+    auto i_4 = dg.insert_vertex(4);
+
+    dg.insert_edges({{i_2, i_1, 1},
+                     {i_2, i_3, 2},
+                     {i_2, i_4, 3},
+                     {i_1, i_3, 4}});
+
+    graphs::CSR_Graph g{dg};
+    static_assert(std::is_same_v<decltype(g)::vertex_type, int>);
+
+    EXPECT_EQ(g.n_vertices(), dg.n_vertices());
+    EXPECT_EQ(g.n_edges(), dg.n_edges());
+    EXPECT_TRUE(std::ranges::equal(g, dg));
+
+    for (auto from_i : std::views::iota(0uz, g.n_vertices()))
+    {
+        EXPECT_TRUE(std::ranges::is_sorted(g.adjacent_vertices(from_i)));
+        EXPECT_EQ(g.vertex_in_degree(from_i), dg.vertex_in_degree(from_i));
+        EXPECT_EQ(g.vertex_out_degree(from_i), dg.vertex_out_degree(from_i));
+
+        for (auto to_i : std::views::iota(0uz, g.n_vertices()))
+        {
+            EXPECT_EQ(g.are_adjacent(from_i, to_i), dg.are_adjacent(from_i, to_i));
+            if (dg.are_adjacent(from_i, to_i))
+            {
+                EXPECT_EQ(g.weight(from_i, to_i), dg.weight(from_i, to_i));
+            }
+        }
+    }
+
+    graphs::Directed_Graph<int, int, graphs::flat_adjacency> flat_dg{1, 2, 3, 4};
+    flat_dg.insert_edges({{i_2, i_1, 1}, {i_2, i_3, 2}, {i_2, i_4, 3}, {i_1, i_3, 4}});
+
+    graphs::CSR_Graph flat_g{flat_dg};
+    for (auto from_i : std::views::iota(0uz, g.n_vertices()))
+    {
+        EXPECT_TRUE(std::ranges::equal(flat_g.adjacent_vertices(from_i),
+                                       flat_dg.adjacent_vertices(from_i)));
+        EXPECT_TRUE(std::ranges::equal(flat_g.adjacent_weights(from_i),
+                                       flat_dg.adjacent_edges(from_i) | std::views::values));
+    }
+}
+
+// Example from "Introduction to Algorithms" by Thomas H. Cormen and others
+TEST(CSR_Graph, Algorithms)
+{
+    enum : std::size_t { s, t, x, y, z };
+
+    graphs::Directed_Graph<char> dg{'s', 't', 'x', 'y', 'z'};
+    dg.insert_edges({{s, t, 10}, {s, y, 5}, {t, x, 1}, {t, y, 2}, {x, z, 4},
+                     {y, t, 3}, {y, x, 9}, {y, z, 2}, {z, s, 7}, {z, x, 6}});
+
+    const graphs::CSR_Graph g{dg};
+
+    graphs::Dijkstra dijkstra{g, s};
+    graphs::Bellman_Ford bellman_ford{g, s};
+    graphs::BFS bfs{g, s};
+    graphs::DFS dfs{g};
+
+    graphs::Dijkstra dg_dijkstra{dg, s};
+    graphs::BFS dg_bfs{dg, s};
+
+    EXPECT_TRUE(bellman_ford);
+
+    for (auto v : {s, t, x, y, z})
+    {
+        EXPECT_EQ(dijkstra.distance(v), dg_dijkstra.distance(v));
+        EXPECT_EQ(bellman_ford.distance(v), dg_dijkstra.distance(v));
+        EXPECT_EQ(dijkstra.path_to(v), dg_dijkstra.path_to(v));
+        EXPECT_EQ(bfs.distance(v), dg_bfs.distance(v));
+        EXPECT_LT(dfs.discovery_time(v), dfs.finished_time(v));
+    }
+}
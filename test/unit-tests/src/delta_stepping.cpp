@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <ranges>
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+
+#include "graphs/directed_graph.hpp"
+#include "algorithms/dijkstra.hpp"
+#include "algorithms/delta_stepping.hpp"
+
+namespace
+{
+
+template<typename W, typename Weight> // W stands for "weight type"
+graphs::Directed_Graph<int, W> random_graph(std::size_t n_vertices, std::size_t n_edges,
+                                            Weight weight, std::mt19937 &gen)
+{
+    std::uniform_int_distribution<std::size_t> vertex{0, n_vertices - 1};
+
+    graphs::Directed_Graph<int, W> g;
+    for (auto v : std::views::iota(0uz, n_vertices))
+        g.insert_vertex(static_cast<int>(v));
+
+    for (auto _ : std::views::iota(0uz, n_edges))
+        g.insert_edge(vertex(gen), vertex(gen), weight(gen));
+
+    return g;
+}
+
+} // unnamed namespace
+
+// Example from "Introduction to Algorithms" by Thomas H. Cormen and others
+TEST(Delta_Stepping, Cormen)
+{
+    enum : std::size_t { s, t, x, y, z };
+
+    graphs::Directed_Graph<char> g{'s', 't', 'x', 'y', 'z'};
+    g.insert_edges({{s, t, 10}, {s, y, 5}, {t, x, 1}, {t, y, 2}, {x, z, 4},
+                    {y, t, 3}, {y, x, 9}, {y, z, 2}, {z, s, 7}, {z, x, 6}});
+
+    for (int delta : {1, 3, 100})
+    {
+        graphs::Delta_Stepping sssp{g, s, delta};
+
+        EXPECT_EQ(sssp.distance(t), 8);
+        EXPECT_EQ(sssp.distance(x), 9);
+        EXPECT_EQ(sssp.distance(y), 5);
+        EXPECT_EQ(sssp.distance(z), 7);
+        EXPECT_EQ(sssp.path_to(x), (std::vector<std::size_t>{s, y, t, x}));
+    }
+
+    EXPECT_THROW((graphs::Delta_Stepping{g, s, 0}), std::invalid_argument);
+    EXPECT_THROW((graphs::Delta_Stepping{g, 5, 1}), std::out_of_range);
+
+    g.insert_edge(x, t, -1);
+    EXPECT_THROW((graphs::Delta_Stepping{g, s, 3}), graphs::Negative_Weights);
+}
+
+TEST(Delta_Stepping, Against_Dijkstra)
+{
+    // large enough for 4 threads
+
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<int> weight{0, 100};
+    const auto g = random_graph<int>(20'000, 100'000, weight, gen);
+
+    using G = graphs::Directed_Graph<int>;
+    graphs::Delta_Stepping<G>::workspace_type ws;
+
+    for (auto s : {0uz, 1uz, 19'999uz})
+    {
+        const graphs::Dijkstra dijkstra{g, s};
+
+        for (int delta : {1, 10, 30, 1'000})
+        {
+            for (unsigned n_threads : {1u, 4u})
+            {
+                const graphs::Delta_Stepping sssp{g, s, ws, delta, n_threads};
+                ASSERT_TRUE(std::ranges::equal(sssp.distances(), dijkstra.distances()));
+
+                for (auto v : {1uz, 100uz, 10'000uz})
+                {
+                    const auto path = sssp.path_to(v);
+                    if (path.empty())
+                        continue;
+
+                    int length = 0;
+                    for (auto i : std::views::iota(1uz, path.size()))
+                        length += g.weight(path[i - 1], path[i]);
+
+                    EXPECT_EQ(sssp.distance(v), length);
+                }
+            }
+        }
+    }
+}
+
+TEST(Delta_Stepping, Workspace_Reuse)
+{
+    // two components: vertices [0, 10'000) and [10'000, 20'000)
+
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<int> weight{0, 100};
+    auto g = random_graph<int>(10'000, 50'000, weight, gen);
+    const auto other = random_graph<int>(10'000, 50'000, weight, gen);
+
+    for (auto v : std::views::iota(0uz, other.n_vertices()))
+        g.insert_vertex(static_cast<int>(v));
+    for (auto u : std::views::iota(0uz, other.n_vertices()))
+    {
+        for (auto [v, w] : other.adjacent_edges(u))
+            g.insert_edge(10'000 + u, 10'000 + v, w);
+    }
+
+    using G = graphs::Directed_Graph<int>;
+    graphs::Delta_Stepping<G>::workspace_type ws;
+
+    for (auto s : {0uz, 10'000uz, 5uz})
+    {
+        const graphs::Dijkstra dijkstra{g, s};
+        const graphs::Delta_Stepping sssp{g, s, ws, 10, 4};
+
+        ASSERT_TRUE(std::ranges::equal(sssp.distances(), dijkstra.distances()));
+
+        // only vertices of the component of the source are touched
+        const auto reached = std::ranges::count_if(dijkstra.distances(),
+                                                   [](auto d){ return !d.is_inf(); });
+        EXPECT_EQ(ws.touched().size(), reached);
+        for (auto v : ws.touched())
+            EXPECT_EQ(v < 10'000, s < 10'000);
+    }
+
+    // a run stopped by a negative weight leaves the workspace reusable
+    g.insert_edge(0, 1, -1);
+    EXPECT_THROW((graphs::Delta_Stepping{g, 0, ws, 10, 4}), graphs::Negative_Weights);
+
+    const graphs::Dijkstra dijkstra{g, 10'000};
+    const graphs::Delta_Stepping sssp{g, 10'000, ws, 10, 4};
+    EXPECT_TRUE(std::ranges::equal(sssp.distances(), dijkstra.distances()));
+}
+
+TEST(Delta_Stepping, Floating_Point_Weights)
+{
+    std::mt19937 gen{42};
+    std::uniform_real_distribution<double> weight{0.0, 1.0};
+    const auto g = random_graph<double>(20'000, 100'000, weight, gen);
+
+    const graphs::Dijkstra dijkstra{g, 0};
+    const graphs::Delta_Stepping sssp{g, 0, 0.1, 4};
+
+    EXPECT_TRUE(std::ranges::equal(sssp.distances(), dijkstra.distances()));
+}
+
+TEST(Delta_Stepping, Long_Paths)
+{
+    // distances grow far beyond the heaviest edge, and buckets don't
+    graphs::Directed_Graph<int> g;
+    for (auto v : std::views::iota(0, 10'000))
+        g.insert_vertex(v);
+    for (auto v : std::views::iota(1uz, g.n_vertices()))
+        g.insert_edge(v - 1, v, 7);
+
+    using G = graphs::Directed_Graph<int>;
+    graphs::Delta_Stepping<G>::workspace_type ws;
+    const graphs::Delta_Stepping sssp{g, 0, ws, 1, 2};
+
+    EXPECT_EQ(sssp.distance(9'999), 7 * 9'999);
+    for (const auto &local : ws.extra().locals)
+        EXPECT_LE(local.buckets.size(), 8);
+}
@@ -4,9 +4,15 @@
 #include <vector>
 #include <unordered_map>
 #include <initializer_list>
+#include <stdexcept>
+#include <random>
+#include <ranges>
 
 #include "graphs/directed_graph.hpp"
+#include "graphs/kgraph.hpp"
 #include "algorithms/dijkstra.hpp"
+#include "utils/transposed_traits.hpp"
+#include "utils/reweighted_graph.hpp"
 
 TEST(Dijkstra, Member_Types)
 {
@@ -112,3 +118,189 @@ TEST(Dijkstra, Negative_Weights)
     EXPECT_TRUE(graphs::Dijkstra<G>::has_negative_weights(g));
     EXPECT_THROW((graphs::Dijkstra{g, it.at('a')}), graphs::Negative_Weights);
 }
+
+TEST(Dijkstra, KGraph)
+{
+    graphs::KGraph g{std::tuple{'a', 'b', 4},
+                     std::tuple{'a', 'd', 2},
+                     std::tuple{'a', 'e', 3},
+                     std::tuple{'b', 'f', 5},
+                     std::tuple{'c', 'f', 1},
+                     std::tuple{'d', 'b', 1},
+                     std::tuple{'e', 'c', 3},
+                     std::tuple{'e', 'f', 2}};
+
+    using G = decltype(g);
+    static_assert(graphs::has_adjacent_edges<graphs::graph_traits<G>, G>);
+
+    graphs::Dijkstra sssp{g, g.find_vertex('a').value()}; // sssp - single-source shortest paths
+
+    std::unordered_map<char, int> distance = {{'a', 0}, {'b', 3}, {'c', 6},
+                                              {'d', 2}, {'e', 3}, {'f', 5}};
+
+    for (auto [v, d] : distance)
+        EXPECT_EQ(sssp.distance(g.find_vertex(v).value()), d);
+
+    EXPECT_EQ(sssp.path_to(g.find_vertex('f').value()),
+              (std::vector{g.find_vertex('a').value(),
+                           g.find_vertex('e').value(),
+                           g.find_vertex('f').value()}));
+}
+
+// distances to a vertex are distances from it in the transpose of the graph
+TEST(Dijkstra, Transposed_Traits)
+{
+    using G = graphs::Directed_Graph<char>;
+
+    enum : std::size_t { a, b, c, d };
+
+    G g{'a', 'b', 'c', 'd'};
+    g.insert_edges({{a, b, 1}, {b, c, 2}, {a, c, 5}, {c, d, 1}, {d, a, 7}});
+
+    graphs::Dijkstra<G, graphs::transposed_traits<G>> to_c{g, c};
+
+    EXPECT_EQ(to_c.distance(a), 3);
+    EXPECT_EQ(to_c.distance(b), 2);
+    EXPECT_EQ(to_c.distance(c), 0);
+    EXPECT_EQ(to_c.distance(d), 10);
+
+    // the path from d to c read backwards
+    EXPECT_TRUE(std::ranges::equal(to_c.path_to(d), std::vector<std::size_t>{c, b, a, d}));
+
+    using Flat_G = graphs::Directed_Graph<char, int, graphs::flat_adjacency>;
+
+    Flat_G flat_g{'a', 'b', 'c', 'd'};
+    flat_g.insert_edges({{a, b, 1}, {b, c, 2}, {a, c, 5}, {c, d, 1}, {d, a, 7}});
+
+    graphs::Dijkstra<Flat_G, graphs::transposed_traits<Flat_G>> flat_to_c{flat_g, c};
+    graphs::Dijkstra flat_from_a{flat_g, a};
+
+    for (auto v : {a, b, c, d})
+        EXPECT_EQ(flat_to_c.distance(v), to_c.distance(v));
+    EXPECT_EQ(flat_from_a.distance(d), 4);
+
+    // weights of a reweighted graph are computed, and the transpose reads them by value
+    const std::vector potentials{0, 1, 3, 4};
+    using R = graphs::Reweighted_Graph<G>;
+    const R reweighted{g, potentials};
+
+    graphs::Dijkstra<R, graphs::transposed_traits<R>> reweighted_to_c{reweighted, c};
+    for (auto v : {a, b, c, d})
+    {
+        EXPECT_EQ(reweighted_to_c.distance(v),
+                  to_c.distance(v) + (potentials[v] - potentials[c]));
+    }
+}
+
+TEST(Dijkstra, Floating_Point_Weights)
+{
+    using G = graphs::Directed_Graph<char, double>;
+
+    enum : std::size_t { a, b, c };
+
+    G g{'a', 'b', 'c'};
+    g.insert_edges({{a, b, 0.5}, {b, c, 0.25}, {a, c, 1.0}});
+
+    graphs::Dijkstra dijkstra{g, a};
+    static_assert(std::is_same_v<decltype(dijkstra)::distance_type, graphs::Distance<double>>);
+
+    EXPECT_DOUBLE_EQ(*dijkstra.distance(c), 0.75);
+    EXPECT_TRUE(std::ranges::equal(dijkstra.path_to(c), std::vector<std::size_t>{a, b, c}));
+
+    g.insert_edge(c, a, -0.5);
+    EXPECT_THROW((graphs::Dijkstra{g, a}), graphs::Negative_Weights);
+}
+
+TEST(Dijkstra, Result_Spans)
+{
+    using G = graphs::Directed_Graph<char>;
+    using distance_type = graphs::Dijkstra<G>::distance_type;
+
+    G g{'a', 'b', 'c', 'd'};
+    g.insert_edges({{0, 1, 2}, {1, 2, 3}, {0, 2, 7}});
+
+    graphs::Dijkstra sssp{g, 0};
+
+    EXPECT_TRUE(std::ranges::equal(sssp.distances(), std::vector<distance_type>{
+                                       0, 2, 5, distance_type{}}));
+    EXPECT_TRUE(std::ranges::equal(sssp.predecessors(), std::vector{sssp.nil, 0uz, 1uz, sssp.nil}));
+    EXPECT_EQ(sssp.predecessor(2), 1);
+    EXPECT_TRUE(sssp.path_to(3).empty());
+    EXPECT_THROW(sssp.distance(4), std::out_of_range);
+}
+
+TEST(Dijkstra, Queue_Policies)
+{
+    using G = graphs::Directed_Graph<int>;
+
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<std::size_t> vertex{0, 499};
+    std::uniform_int_distribution<int> weight{0, 20};
+
+    G g;
+    for (auto v : std::views::iota(0, 500))
+        g.insert_vertex(v);
+    for (auto _ : std::views::iota(0, 3'000))
+        g.insert_edge(vertex(gen), vertex(gen), weight(gen));
+
+    auto check = [&]<typename Queue>(Queue)
+    {
+        typename graphs::Dijkstra<G, graphs::graph_traits<G>, Queue>::workspace_type ws;
+
+        for (auto s : {0uz, 0uz, 7uz}) // the second run reuses the workspace
+        {
+            graphs::Dijkstra<G, graphs::graph_traits<G>, Queue> sssp{g, s, ws};
+            graphs::Dijkstra<G, graphs::graph_traits<G>, graphs::fibonacci_heap> ref{g, s};
+
+            EXPECT_TRUE(std::ranges::equal(sssp.distances(), ref.distances()));
+            for (auto v : std::views::iota(0uz, g.n_vertices()))
+            {
+                if (auto p = sssp.predecessor(v); p != sssp.nil)
+                {
+                    EXPECT_EQ(sssp.distance(v), sssp.distance(p) + g.weight(p, v));
+                }
+            }
+        }
+    };
+
+    check(graphs::d_ary_heap<2>{});
+    check(graphs::d_ary_heap<4>{});
+    check(graphs::lazy_heap{});
+    check(graphs::radix_heap{});
+    check(graphs::dial_buckets{});
+}
+
+TEST(Dijkstra, Target)
+{
+    using G = graphs::Directed_Graph<int>;
+
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<std::size_t> vertex{0, 299};
+    std::uniform_int_distribution<int> weight{0, 20};
+
+    G g;
+    for (auto v : std::views::iota(0, 300))
+        g.insert_vertex(v);
+    for (auto _ : std::views::iota(0, 1'500))
+        g.insert_edge(vertex(gen), vertex(gen), weight(gen));
+
+    graphs::Dijkstra<G>::workspace_type ws;
+
+    for (auto _ : std::views::iota(0, 20))
+    {
+        const auto s = vertex(gen);
+        const auto t = vertex(gen);
+
+        graphs::Dijkstra full{g, s};
+        graphs::Dijkstra to_t{g, s, t, ws};
+
+        EXPECT_EQ(to_t.distance(t), full.distance(t));
+        EXPECT_EQ(to_t.path_to(t).size(), full.path_to(t).size());
+        if (!full.distance(t).is_inf())
+        {
+            EXPECT_LE(ws.touched().size(), full.workspace().touched().size());
+        }
+    }
+
+    EXPECT_THROW((graphs::Dijkstra{g, 0, 300}), std::out_of_range);
+}
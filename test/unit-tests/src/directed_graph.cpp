@@ -4,6 +4,9 @@
 #include <algorithm>
 #include <type_traits>
 #include <set>
+#include <vector>
+#include <tuple>
+#include <stdexcept>
 
 #include "graphs/directed_graph.hpp"
 
@@ -135,8 +138,17 @@ TEST(Directed_Graph, Erase_Vertex)
 
     g.erase_vertex(i_4);
 
-    EXPECT_EQ(g.n_vertices(), 3);
+    // the tombstone of the last vertex is kept, so its index isn't reused
+    EXPECT_EQ(g.n_vertices(), 4);
+    EXPECT_EQ(g.n_erased_vertices(), 1);
     EXPECT_EQ(g.n_edges(), 2);
+    EXPECT_TRUE(g.is_erased(i_4));
+    EXPECT_FALSE(g.are_adjacent(i_4, i_1));
+
+    auto i_5 = g.insert_vertex(5);
+    EXPECT_NE(i_5, i_4);
+    EXPECT_EQ(g.vertex(i_5), 5);
+    EXPECT_THROW(g.vertex(i_4), std::out_of_range);
 
     EXPECT_FALSE(g.are_adjacent(i_1, i_1));
     EXPECT_TRUE(g.are_adjacent(i_1, i_2));
@@ -151,6 +163,88 @@ TEST(Directed_Graph, Erase_Vertex)
     EXPECT_FALSE(g.are_adjacent(i_3, i_3));
 }
 
+/*
+ * 1 ---> 2 ---> 3 ---> 4
+ * ^                    |
+ * |                    |
+ * +--------------------+
+ */
+TEST(Directed_Graph, Erase_Vertex_And_Compact)
+{
+    graphs::Directed_Graph g{1, 2, 3, 4};
+    g.insert_edges({{0, 1, 10}, {1, 2, 20}, {2, 3, 30}, {3, 0, 40}});
+
+    g.erase_vertex(1);
+
+    // indices of other vertices are stable
+    EXPECT_EQ(g.n_vertices(), 4);
+    EXPECT_EQ(g.n_erased_vertices(), 1);
+    EXPECT_EQ(g.n_edges(), 2);
+    EXPECT_TRUE(g.is_erased(1));
+    EXPECT_EQ(g.vertex(2), 3);
+    EXPECT_EQ(g.weight(2, 3), 30);
+    EXPECT_EQ(g.vertex_in_degree(2), 0);
+    EXPECT_THROW(g.vertex(1), std::out_of_range);
+    EXPECT_THROW(g.insert_edge(0, 1), std::out_of_range);
+
+    g.vertex(3) = 5;
+    auto new_indices = g.compact();
+
+    ASSERT_EQ(new_indices.size(), 4);
+    EXPECT_EQ(new_indices[0], 0);
+    EXPECT_FALSE(new_indices[1].has_value());
+    EXPECT_EQ(new_indices[2], 1);
+    EXPECT_EQ(new_indices[3], 2);
+
+    EXPECT_EQ(g.n_vertices(), 3);
+    EXPECT_EQ(g.n_erased_vertices(), 0);
+    EXPECT_EQ(g.n_edges(), 2);
+    EXPECT_TRUE(std::ranges::equal(g, std::vector{1, 3, 5}));
+    EXPECT_EQ(g.weight(1, 2), 30);
+    EXPECT_EQ(g.weight(2, 0), 40);
+    EXPECT_FALSE(g.are_adjacent(0, 1));
+
+    EXPECT_TRUE(std::ranges::equal(g.incoming_vertices(0), std::vector{2uz}));
+    EXPECT_TRUE(std::ranges::equal(g.incoming_vertices(2), std::vector{1uz}));
+
+    // weights are stored next to adjacent vertices and move with them
+    g.change_weight(1, 2, 35);
+    std::vector<std::pair<std::size_t, int>> edges;
+    for (auto [to, w] : g.adjacent_edges(1))
+        edges.emplace_back(to, w);
+    EXPECT_EQ(edges, (std::vector<std::pair<std::size_t, int>>{{2, 35}}));
+    EXPECT_THROW(g.weight(1, 0), std::out_of_range);
+
+    // tombstones are kept until the next compact(), even at the end
+    g.erase_vertex(1);
+    g.erase_vertex(2);
+    EXPECT_EQ(g.n_vertices(), 3);
+    EXPECT_EQ(g.n_erased_vertices(), 2);
+    EXPECT_EQ(g.n_edges(), 0);
+
+    new_indices = g.compact();
+    EXPECT_EQ(new_indices[0], 0);
+    EXPECT_EQ(g.n_vertices(), 1);
+}
+
+TEST(Directed_Graph, Compact_Keeps_Payloads)
+{
+    // vertices before the first erased one stay in place and must keep their payloads
+
+    using payload = std::vector<int>;
+    graphs::Directed_Graph<payload> g{payload{1, 2}, payload{3, 4}, payload{5}, payload{6, 7}};
+    g.insert_edges({{0, 1, 10}, {1, 3, 20}, {3, 0, 30}});
+
+    g.erase_vertex(2);
+    auto new_indices = g.compact();
+
+    EXPECT_EQ(new_indices[3], 2);
+    EXPECT_TRUE(std::ranges::equal(g, std::vector{payload{1, 2}, payload{3, 4}, payload{6, 7}}));
+    EXPECT_EQ(g.weight(0, 1), 10);
+    EXPECT_EQ(g.weight(1, 2), 20);
+    EXPECT_EQ(g.weight(2, 0), 30);
+}
+
 /*
  * +--- 1 ---> 2 ---> 3
  * |    ^
@@ -254,3 +348,97 @@ TEST(Directed_Graph, Vertex_Degree)
     EXPECT_EQ(g.vertex_out_degree(i_4), 0);
     EXPECT_EQ(g.vertex_degree(i_4), 1);
 }
+
+TEST(Directed_Graph, Insert_Edges_Sorted_Dedup)
+{
+    graphs::Directed_Graph<int> g{1, 2, 3};
+    g.insert_edge(0, 1, 10);
+
+    std::vector<std::tuple<std::size_t, std::size_t, int>> edges{{0, 1, 1},  // already in g
+                                                                 {1, 2, 5},
+                                                                 {2, 1, 3},
+                                                                 {1, 2, 2}}; // duplicate
+
+    g.insert_edges(edges.begin(), edges.end(), graphs::sorted_dedup{graphs::keep_weight::min});
+
+    EXPECT_EQ(g.n_edges(), 3);
+    EXPECT_EQ(g.weight(0, 1), 10);
+    EXPECT_EQ(g.weight(1, 2), 2);
+    EXPECT_EQ(g.weight(2, 1), 3);
+
+    std::vector<std::pair<std::size_t, std::size_t>> unweighted_edges{{2, 0}, {2, 0}};
+    g.insert_edges(unweighted_edges.begin(), unweighted_edges.end(), graphs::sorted_dedup{});
+
+    EXPECT_EQ(g.n_edges(), 4);
+    EXPECT_EQ(g.weight(2, 0), graphs::Directed_Graph<int>::default_weight);
+}
+
+TEST(Directed_Graph, Incoming_Vertices)
+{
+    graphs::Directed_Graph g{1, 2, 3, 4};
+    g.insert_edges({{0, 2}, {1, 2}, {3, 2}, {2, 0}, {2, 2}});
+
+    std::set<std::size_t> incoming(g.incoming_vertices(2).begin(), g.incoming_vertices(2).end());
+    EXPECT_EQ(incoming, (std::set<std::size_t>{0, 1, 2, 3}));
+    EXPECT_EQ(g.vertex_in_degree(2), 4);
+    EXPECT_EQ(g.vertex_degree(2), 6);
+    for (auto [from, w] : g.incoming_edges(2))
+        EXPECT_EQ(w, g.weight(from, 2));
+
+    g.erase_edge(1, 2);
+    g.erase_edge(1, 2); // no effect
+    EXPECT_EQ(g.vertex_in_degree(2), 3);
+
+    g.erase_vertex(3);
+    EXPECT_EQ(g.vertex_in_degree(2), 2);
+
+    g.erase_vertex(2);
+    EXPECT_EQ(g.vertex_in_degree(0), 0);
+    EXPECT_EQ(g.vertex_out_degree(0), 0);
+    EXPECT_EQ(g.n_edges(), 0);
+}
+
+TEST(Directed_Graph, Flat_Adjacency)
+{
+    graphs::Directed_Graph<int, int, graphs::flat_adjacency> g{1, 2, 3, 4};
+    g.insert_edges({{0, 3, 4}, {0, 1, 2}, {0, 2, 3}, {2, 0, 5}, {2, 2, 6}});
+    g.insert_edge(0, 1, 10); // already exists
+
+    EXPECT_EQ(g.n_edges(), 5);
+    EXPECT_TRUE(std::ranges::equal(g.adjacent_vertices(0), std::vector{1uz, 2uz, 3uz}));
+    EXPECT_TRUE(std::ranges::equal(g.incoming_vertices(2), std::vector{0uz, 2uz}));
+    EXPECT_TRUE(g.are_adjacent(0, 2));
+    EXPECT_FALSE(g.are_adjacent(2, 1));
+    EXPECT_EQ(g.weight(0, 1), 2);
+    EXPECT_EQ(g.weight(0, 3), 4);
+    EXPECT_THROW(g.weight(1, 0), std::out_of_range);
+
+    std::vector<std::pair<std::size_t, int>> edges;
+    for (auto [to, w] : g.adjacent_edges(0))
+        edges.emplace_back(to, w);
+    EXPECT_EQ(edges, (std::vector<std::pair<std::size_t, int>>{{1, 2}, {2, 3}, {3, 4}}));
+
+    g.change_weight(0, 2, 7);
+    EXPECT_EQ(g.weight(0, 2), 7);
+
+    edges.clear();
+    for (auto [from, w] : g.incoming_edges(2))
+        edges.emplace_back(from, w);
+    EXPECT_EQ(edges, (std::vector<std::pair<std::size_t, int>>{{0, 7}, {2, 6}}));
+
+    g.erase_edge(0, 2);
+    EXPECT_FALSE(g.are_adjacent(0, 2));
+    EXPECT_EQ(g.weight(0, 3), 4);
+    EXPECT_EQ(g.vertex_in_degree(2), 1);
+
+    g.erase_vertex(1);
+    auto new_indices = g.compact();
+    EXPECT_EQ(new_indices[3], 2);
+    EXPECT_EQ(g.n_edges(), 3);
+    EXPECT_TRUE(std::ranges::equal(g.adjacent_vertices(0), std::vector{2uz}));
+    EXPECT_EQ(g.weight(0, 2), 4);
+    EXPECT_EQ(g.weight(1, 0), 5);
+    EXPECT_EQ(g.weight(1, 1), 6);
+    EXPECT_TRUE(std::ranges::equal(g.incoming_vertices(0), std::vector{1uz}));
+    EXPECT_EQ((*g.incoming_edges(2).begin()).second, 4);
+}
@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <compare>
+#include <limits>
+#include <type_traits>
+
 #include "utils/distance.hpp"
 
 TEST(Distance, Constructors)
@@ -91,3 +95,36 @@ TEST(Distance, Sum)
     EXPECT_EQ(inf + 10, inf);
     EXPECT_EQ(10 + inf, inf);
 }
+
+TEST(Distance, Floating_Point)
+{
+    graphs::Distance d_1{0.5};
+    graphs::Distance d_2{1.5};
+    auto inf = graphs::Distance<double>::inf();
+
+    static_assert(std::is_same_v<decltype(d_1 <=> d_2), std::partial_ordering>);
+
+    EXPECT_LT(d_1, d_2);
+    EXPECT_LT(d_2, inf);
+    EXPECT_EQ(d_1 + d_2, 2.0);
+    EXPECT_EQ(d_1 + inf, inf);
+}
+
+TEST(Distance, Saturation)
+{
+    using limits = std::numeric_limits<int>;
+
+    static_assert(sizeof(graphs::Distance<int>) == sizeof(int));
+    static_assert(sizeof(graphs::Distance<double>) == sizeof(double));
+
+    graphs::Distance<int> d{limits::max() - 10};
+    auto inf = graphs::Distance<int>::inf();
+
+    EXPECT_EQ(d + 5, limits::max() - 5);
+    EXPECT_EQ(d + 20, inf); // overflow makes the distance infinite
+    EXPECT_TRUE((d + d).is_inf());
+    EXPECT_EQ(inf + (-5), inf);
+    EXPECT_EQ(graphs::Distance<int>{limits::min() + 1} + (-5), limits::min());
+
+    EXPECT_TRUE((graphs::Distance<unsigned>{4'000'000'000u} + 500'000'000u).is_inf());
+}
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+
+#include "utils/edge_dedup.hpp"
+
+TEST(Edge_Dedup, Pack_Edge)
+{
+    EXPECT_LT(graphs::pack_edge(1, 2), graphs::pack_edge(1, 3));
+    EXPECT_LT(graphs::pack_edge(1, 3), graphs::pack_edge(2, 0));
+
+    auto [from, to] = graphs::unpack_edge(graphs::pack_edge(42, 7));
+    EXPECT_EQ(from, 42);
+    EXPECT_EQ(to, 7);
+
+    EXPECT_THROW(graphs::pack_edge(std::size_t{1} << 32, 0), std::length_error);
+}
+
+TEST(Edge_Dedup, Keep_Weight)
+{
+    std::vector<std::uint64_t> keys{graphs::pack_edge(1, 2),  // 0
+                                    graphs::pack_edge(0, 1),  // 1
+                                    graphs::pack_edge(1, 2),  // 2
+                                    graphs::pack_edge(0, 1),  // 3
+                                    graphs::pack_edge(1, 2)}; // 4
+    std::vector<int> weights{5, 3, 4, 7, 4};
+
+    auto weight_less = [&weights](std::size_t i, std::size_t j){ return weights[i] < weights[j]; };
+
+    using kept_type = std::vector<std::pair<std::uint64_t, std::size_t>>;
+
+    EXPECT_EQ(graphs::dedup_edges(keys, {graphs::keep_weight::first}, weight_less),
+              (kept_type{{keys[1], 1}, {keys[0], 0}}));
+    EXPECT_EQ(graphs::dedup_edges(keys, {graphs::keep_weight::last}, weight_less),
+              (kept_type{{keys[1], 3}, {keys[0], 4}}));
+    EXPECT_EQ(graphs::dedup_edges(keys, {graphs::keep_weight::min}, weight_less),
+              (kept_type{{keys[1], 1}, {keys[0], 2}}));
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <random>
+#include <map>
+#include <utility>
+#include <stdexcept>
+
+#include "utils/edge_map.hpp"
+
+TEST(Edge_Map, Basic_Operations)
+{
+    graphs::Edge_Map<int> map;
+
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find({0, 1}), nullptr);
+    EXPECT_THROW(map.at({0, 1}), std::out_of_range);
+
+    EXPECT_TRUE(map.emplace({0, 1}, 5));
+    EXPECT_FALSE(map.emplace({0, 1}, 6)); // the value isn't replaced
+    EXPECT_TRUE(map.emplace({1, 0}, 7));
+
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(map.at({0, 1}), 5);
+    EXPECT_EQ(map.at({1, 0}), 7);
+    EXPECT_FALSE(map.contains({1, 1}));
+
+    map[{1, 1}] += 3;
+    map.at({0, 1}) = 8;
+    EXPECT_EQ(map.at({1, 1}), 3);
+    EXPECT_EQ(*map.find({0, 1}), 8);
+
+    EXPECT_EQ(map.erase({0, 1}), 1);
+    EXPECT_EQ(map.erase({0, 1}), 0);
+    EXPECT_FALSE(map.contains({0, 1}));
+    EXPECT_EQ(map.size(), 2);
+
+    int sum = 0;
+    map.for_each([&sum](auto, int value){ sum += value; });
+    EXPECT_EQ(sum, 10);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.contains({1, 0}));
+}
+
+// random insertions and erasures are checked against std::map
+TEST(Edge_Map, Against_Std_Map)
+{
+    graphs::Edge_Map<std::size_t> map;
+    std::map<std::pair<std::size_t, std::size_t>, std::size_t> ref;
+
+    std::mt19937_64 gen{42};
+    std::uniform_int_distribution<std::size_t> vertex{0, 200};
+    std::bernoulli_distribution erase{0.3};
+
+    for (auto i = 0uz; i != 100'000; ++i)
+    {
+        std::pair edge{vertex(gen), vertex(gen)};
+
+        if (erase(gen))
+            ASSERT_EQ(map.erase(edge), ref.erase(edge));
+        else
+            ASSERT_EQ(map.emplace(edge, i), ref.emplace(edge, i).second);
+    }
+
+    ASSERT_EQ(map.size(), ref.size());
+    for (auto &[edge, value] : ref)
+        EXPECT_EQ(map.at(edge), value);
+
+    std::size_t n_visited = 0;
+    map.for_each([&](auto edge, std::size_t value)
+    {
+        EXPECT_EQ(ref.at(edge), value);
+        ++n_visited;
+    });
+    EXPECT_EQ(n_visited, ref.size());
+
+    map.reserve(100'000);
+    EXPECT_GE(map.bucket_count(), 100'000);
+    for (auto &[edge, value] : ref)
+        EXPECT_EQ(map.at(edge), value);
+}
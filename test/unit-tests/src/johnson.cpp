@@ -1,8 +1,17 @@
 #include <gtest/gtest.h>
 
 #include <unordered_map>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <ranges>
+#include <utility>
+#include <type_traits>
+#include <algorithm>
+#include <cstddef>
 
 #include "graphs/directed_graph.hpp"
+#include "graphs/csr_graph.hpp"
 #include "algorithms/johnson.hpp"
 
 TEST(Johnson, Nonunique_Paths)
@@ -124,3 +133,174 @@ TEST(Johnson, From_Cormen)
     EXPECT_FALSE(apsp2);
     EXPECT_TRUE(apsp2.has_negative_weight_cycles());
 }
+
+TEST(Johnson, CSR_Graph)
+{
+    enum : std::size_t { a, b, c, d };
+
+    graphs::CSR_Graph<char> g{{'a', 'b', 'c', 'd'},
+                              {{a, b, 2}, {a, c, -2}, {b, a, -1}, {c, a, 4}, {c, d, 1}}};
+
+    graphs::Johnson apsp{g}; // apsp - all-pairs shortest paths
+
+    EXPECT_TRUE(apsp);
+
+    EXPECT_EQ(apsp.distance(a, d), -1);
+    EXPECT_EQ(apsp.distance(b, c), -3);
+    EXPECT_EQ(apsp.distance(c, b), 6);
+    EXPECT_EQ(apsp.distance(d, a), graphs::Distance<int>::inf());
+
+    EXPECT_EQ(g.weight(a, c), -2); // the graph is not modified
+
+    // a negative weight cycle
+    const graphs::CSR_Graph<char> g2{{'a', 'b', 'c', 'd'},
+                                     {{a, b, 2}, {a, c, -2}, {b, a, -3}, {c, a, 4}, {c, d, 1}}};
+
+    graphs::Johnson apsp2{g2};
+
+    EXPECT_FALSE(apsp2);
+    EXPECT_TRUE(apsp2.has_negative_weight_cycles());
+}
+
+namespace
+{
+
+// a read-only graph: lists of pairs (head, weight) of outgoing edges of every vertex
+using Edge_Lists = std::vector<std::vector<std::pair<std::size_t, int>>>;
+
+struct edge_lists_traits
+{
+    using size_type = std::size_t;
+    using vertex_type = std::size_t;
+    using weight_type = int;
+
+    static constexpr bool is_directed = true;
+
+    static size_type n_vertices(const Edge_Lists &g) { return g.size(); }
+
+    static size_type n_edges(const Edge_Lists &g)
+    {
+        size_type n = 0;
+        for (const auto &edges : g)
+            n += edges.size();
+
+        return n;
+    }
+
+    static auto adjacent_vertices(const Edge_Lists &g, size_type i)
+    {
+        return g[i] | std::views::keys;
+    }
+
+    static auto adjacent_edges(const Edge_Lists &g, size_type i) { return std::views::all(g[i]); }
+
+    static const weight_type &weight(const Edge_Lists &g, size_type from, size_type to)
+    {
+        return std::ranges::find(g[from], to, &Edge_Lists::value_type::value_type::first)->second;
+    }
+};
+
+} // unnamed namespace
+
+TEST(Johnson, Read_Only_Graph)
+{
+    enum : std::size_t { a, b, c, d };
+
+    const Edge_Lists g{{{b, 2}, {c, -2}}, {{a, -1}}, {{a, 4}, {d, 1}}, {}};
+
+    graphs::Johnson<Edge_Lists, edge_lists_traits> apsp{g};
+
+    EXPECT_TRUE(apsp);
+
+    EXPECT_EQ(apsp.distance(a, d), -1);
+    EXPECT_EQ(apsp.distance(b, c), -3);
+    EXPECT_EQ(apsp.distance(c, b), 6);
+    EXPECT_EQ(apsp.distance(d, a), graphs::Distance<int>::inf());
+
+    // weights of the view are w(u, v) + h(u) - h(v)
+
+    const std::vector<int> h{0, -1, -2, 0};
+    const graphs::Reweighted_Graph<Edge_Lists, edge_lists_traits> reweighted{g, h};
+    using reweighted_traits = graphs::graph_traits<std::remove_cvref_t<decltype(reweighted)>>;
+
+    EXPECT_EQ(reweighted_traits::weight(reweighted, a, b), 3);
+    EXPECT_EQ(reweighted_traits::weight(reweighted, c, d), -1);
+    EXPECT_EQ(reweighted_traits::n_edges(reweighted), 5);
+
+    std::vector<std::pair<std::size_t, int>> edges;
+    for (auto [v, w] : reweighted_traits::adjacent_edges(reweighted, a))
+        edges.emplace_back(v, w);
+
+    EXPECT_EQ(edges, (std::vector<std::pair<std::size_t, int>>{{b, 3}, {c, 0}}));
+}
+
+TEST(Johnson, Weight_Types)
+{
+    enum : std::size_t { a, b, c, d };
+
+    graphs::Directed_Graph<char, double> g{'a', 'b', 'c', 'd'};
+    g.insert_edges({{a, b, 0.2}, {a, c, -0.2}, {b, a, -0.1}, {c, a, 0.4}, {c, d, 0.1}});
+
+    graphs::Johnson apsp{g};
+
+    EXPECT_TRUE(apsp);
+    EXPECT_DOUBLE_EQ(*apsp.distance(a, d), -0.1);
+    EXPECT_DOUBLE_EQ(*apsp.distance(b, c), -0.3);
+    EXPECT_DOUBLE_EQ(*apsp.distance(c, b), 0.6);
+    EXPECT_TRUE(apsp.distance(d, a).is_inf());
+
+    // the sum of weights doesn't fit in 32 bits
+    graphs::Directed_Graph<char, std::int64_t> g_64{'a', 'b', 'c'};
+    g_64.insert_edges({{a, b, 3'000'000'000}, {b, c, 3'000'000'000}, {a, c, 7'000'000'000}});
+
+    graphs::Johnson apsp_64{g_64};
+
+    EXPECT_EQ(apsp_64.distance(a, c), std::int64_t{6'000'000'000});
+}
+
+TEST(Johnson, Queue_Policies)
+{
+    using G = graphs::Directed_Graph<int>;
+    using Traits = graphs::graph_traits<G>;
+
+    // weights w(u, v) = base + p[v] - p[u] with non-negative base can be negative, but there are
+    // no negative weight cycles
+
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<std::size_t> vertex{0, 99};
+    std::uniform_int_distribution<int> base{0, 20};
+    std::uniform_int_distribution<int> potential{-10, 10};
+
+    G g;
+    std::vector<int> p;
+    for (auto v : std::views::iota(0, 100))
+    {
+        g.insert_vertex(v);
+        p.push_back(potential(gen));
+    }
+
+    for (auto _ : std::views::iota(0, 500))
+    {
+        auto from = vertex(gen);
+        auto to = vertex(gen);
+        g.insert_edge(from, to, base(gen) + p[to] - p[from]);
+    }
+
+    graphs::Johnson<G, Traits, graphs::fibonacci_heap> ref{g};
+    graphs::Johnson<G, Traits> radix{g};
+    graphs::Johnson<G, Traits, graphs::dial_buckets> dial{g};
+    graphs::Johnson<G, Traits, graphs::d_ary_heap<4>> quaternary{g};
+    graphs::Johnson<G, Traits, graphs::radix_heap, graphs::parallel_rounds> parallel{g, {2}};
+
+    EXPECT_TRUE(ref);
+    for (auto u : std::views::iota(0uz, g.n_vertices()))
+    {
+        for (auto v : std::views::iota(0uz, g.n_vertices()))
+        {
+            EXPECT_EQ(radix.distance(u, v), ref.distance(u, v));
+            EXPECT_EQ(dial.distance(u, v), ref.distance(u, v));
+            EXPECT_EQ(quaternary.distance(u, v), ref.distance(u, v));
+            EXPECT_EQ(parallel.distance(u, v), ref.distance(u, v));
+        }
+    }
+}
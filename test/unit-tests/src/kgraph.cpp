@@ -1,8 +1,11 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <algorithm>
+#include <cstdint>
 #include <vector>
 #include <unordered_set>
+#include <stdexcept>
 
 #include "pair_like.hpp"
 #include "tuple_like.hpp"
@@ -316,3 +319,314 @@ TEST(KGraph, AdjacentEdgesIterator)
         EXPECT_EQ(adjacent_edges, adjacent_edges_model[i]);
     }
 }
+
+TEST(KGraph, Sorted_Dedup_Constructor)
+{
+    std::vector edges{std::tuple{1, 2, 'p'},
+                      std::tuple{1, 3, 'q'},
+                      std::tuple{2, 3, 'r'},
+                      std::tuple{3, 1, 'a'}, // duplicate of (1, 3)
+                      std::tuple{2, 4, 's'},
+                      std::tuple{3, 4, 't'},
+                      std::tuple{4, 2, 'z'}}; // duplicate of (2, 4)
+
+    graphs::KGraph g_1(edges.begin(), edges.end());
+    graphs::KGraph g_2(edges.begin(), edges.end(), graphs::sorted_dedup{});
+
+    static_assert(std::is_same_v<decltype(g_1), decltype(g_2)>);
+    EXPECT_EQ(g_2.n_vertices(), g_1.n_vertices());
+    EXPECT_EQ(g_2.n_edges(), g_1.n_edges());
+
+    for (auto v : std::views::iota(1, 4 + 1))
+    {
+        EXPECT_EQ(g_2.find_vertex(v), g_1.find_vertex(v));
+
+        auto index = g_2.find_vertex(v).value();
+        std::unordered_set adjacent_vertices_1(g_1.av_begin(index), g_1.av_end(index));
+        std::unordered_set adjacent_vertices_2(g_2.av_begin(index), g_2.av_end(index));
+        EXPECT_EQ(adjacent_vertices_2, adjacent_vertices_1);
+
+        for (auto u : adjacent_vertices_2)
+            EXPECT_EQ(g_2.weight(index, u), g_1.weight(index, u));
+    }
+
+    auto weight = [](const auto &g, int from, int to)
+    {
+        return g.weight(g.find_vertex(from).value(), g.find_vertex(to).value());
+    };
+
+    graphs::KGraph g_3(edges.begin(), edges.end(), graphs::sorted_dedup{graphs::keep_weight::last});
+    EXPECT_EQ(weight(g_3, 1, 3), 'a');
+    EXPECT_EQ(weight(g_3, 2, 4), 'z');
+
+    graphs::KGraph g_4(edges.begin(), edges.end(), graphs::sorted_dedup{graphs::keep_weight::min});
+    EXPECT_EQ(weight(g_4, 1, 3), 'a');
+    EXPECT_EQ(weight(g_4, 2, 4), 's');
+
+    std::vector unweighted_edges{std::pair{1, 2}, std::pair{2, 1}, std::pair{2, 3}};
+    graphs::KGraph g_5(unweighted_edges.begin(), unweighted_edges.end(), graphs::sorted_dedup{});
+    static_assert(!decltype(g_5)::weighted());
+    EXPECT_EQ(g_5.n_vertices(), 3);
+    EXPECT_EQ(g_5.n_edges(), 2);
+
+    // keep_weight::min needs ordered edge values, so sorted deduplication does too
+    struct Unordered { int value; };
+    using Edge_It = std::vector<std::tuple<int, int, Unordered>>::iterator;
+    static_assert(std::constructible_from<graphs::KGraph<int, Unordered>, Edge_It, Edge_It>);
+    static_assert(!std::constructible_from<graphs::KGraph<int, Unordered>, Edge_It, Edge_It,
+                                           graphs::sorted_dedup>);
+}
+
+TEST(KGraph, Find_Vertices)
+{
+    graphs::KGraph g{std::tuple{1, 2, 'p'},
+                     std::tuple{1, 3, 'q'},
+                     std::tuple{2, 3, 'r'},
+                     std::tuple{2, 4, 's'},
+                     std::tuple{3, 4, 't'}};
+
+    EXPECT_FALSE(g.find_vertex(5).has_value());
+
+    std::vector values{4, 5, 1, 1};
+    auto indices = g.find_vertices(values);
+
+    ASSERT_EQ(indices.size(), values.size());
+    EXPECT_EQ(indices[0], g.find_vertex(4));
+    EXPECT_FALSE(indices[1].has_value());
+    EXPECT_EQ(indices[2], g.find_vertex(1));
+    EXPECT_EQ(indices[3], g.find_vertex(1));
+
+    // vertices are numbered in order of appearance
+    auto all_indices = g.find_vertices(std::views::iota(1, 4 + 1));
+    for (auto i : std::views::iota(0uz, g.n_vertices()))
+        EXPECT_EQ(all_indices[i], i);
+
+    // the vertex index gives the same results and follows insertions
+    EXPECT_FALSE(g.vertex_index_enabled());
+    g.enable_vertex_index();
+    EXPECT_EQ(g.find_vertices(values), indices);
+
+    const auto five = g.insert_vertex(5);
+    EXPECT_EQ(g.find_vertex(5), five);
+    EXPECT_EQ(g.insert_vertex(5), five);
+
+    g.enable_vertex_index(false);
+    EXPECT_EQ(g.find_vertex(5), five);
+    EXPECT_FALSE(g.find_vertex(6).has_value());
+}
+
+TEST(KGraph, Edge_Index)
+{
+    std::vector<std::tuple<int, int, int>> edges;
+    for (auto v : std::views::iota(1, 100))
+        edges.emplace_back(0, v, v * 10); // 0 is a hub
+    edges.emplace_back(1, 2, 12);
+    edges.emplace_back(5, 5, 55);         // self-loop
+
+    graphs::KGraph g(edges.begin(), edges.end());
+    graphs::KGraph g_indexed = g;
+    g_indexed.enable_edge_index();
+
+    EXPECT_FALSE(g.edge_index_enabled());
+    EXPECT_TRUE(g_indexed.edge_index_enabled());
+
+    for (auto from : std::views::iota(0uz, g.n_vertices()))
+    {
+        for (auto to : std::views::iota(0uz, g.n_vertices()))
+        {
+            ASSERT_EQ(g_indexed.are_adjacent(from, to), g.are_adjacent(from, to));
+            if (g.are_adjacent(from, to))
+            {
+                EXPECT_EQ(g_indexed.weight(from, to), g.weight(from, to));
+            }
+            else
+            {
+                EXPECT_THROW(g_indexed.weight(from, to), std::runtime_error);
+            }
+        }
+    }
+
+    auto i_0 = g.find_vertex(0).value();
+    auto i_5 = g.find_vertex(5).value();
+    EXPECT_EQ(g_indexed.weight(i_0, g.find_vertex(42).value()), 420);
+    EXPECT_EQ(g_indexed.weight(i_5, i_5), 55);
+    EXPECT_THROW(g_indexed.are_adjacent(i_0, g.n_vertices()), std::out_of_range);
+
+    g_indexed.enable_edge_index(false);
+    EXPECT_EQ(g_indexed.weight(i_0, i_5), 50);
+}
+
+TEST(KGraph, Edge_Index_Updates)
+{
+    std::vector<std::tuple<int, int, int>> edges;
+    for (auto v : std::views::iota(1, 20))
+        edges.emplace_back(0, v, v);
+
+    graphs::KGraph g(edges.begin(), edges.end());
+    g.enable_edge_index();
+    g.build_edge_index();
+
+    auto i_0 = g.find_vertex(0).value();
+    auto i_3 = g.find_vertex(3).value();
+    auto i_7 = g.find_vertex(7).value();
+
+    g.erase_edge(i_0, i_3);
+    EXPECT_FALSE(g.are_adjacent(i_0, i_3));
+    EXPECT_FALSE(g.are_adjacent(i_3, i_0));
+
+    g.insert_edge(i_3, i_7, 37);
+    EXPECT_EQ(g.weight(i_7, i_3), 37);
+
+    auto i_20 = g.insert_vertex(20);
+    EXPECT_FALSE(g.are_adjacent(i_20, i_0));
+    g.insert_edge(i_0, i_20, 20);
+    g.insert_edge(i_20, i_20, 40); // self-loop
+    EXPECT_EQ(g.weight(i_20, i_0), 20);
+    EXPECT_EQ(g.weight(i_20, i_20), 40);
+
+    g.erase_edge(i_20, i_20);
+    g.insert_edge(i_0, i_3, 3); // reuses edge nodes from the free list
+    EXPECT_EQ(g.weight(i_3, i_0), 3);
+
+    // the index kept up to date agrees with the graph everywhere
+    graphs::KGraph g_plain = g;
+    g_plain.enable_edge_index(false);
+    for (auto from : std::views::iota(0uz, g.n_vertices()))
+    {
+        for (auto to : std::views::iota(0uz, g.n_vertices()))
+            ASSERT_EQ(g.are_adjacent(from, to), g_plain.are_adjacent(from, to));
+    }
+}
+
+TEST(KGraph, Narrow_Index_Type)
+{
+    std::vector<std::tuple<int, int, int>> edges;
+    for (auto v : std::views::iota(0, 50))
+        edges.emplace_back(v, (v * 7 + 3) % 50, v);
+    edges.emplace_back(7, 7, 77); // self-loop
+
+    graphs::KGraph g(edges.begin(), edges.end());
+    graphs::KGraph<int, int, std::uint32_t> g_32(edges.begin(), edges.end());
+
+    static_assert(std::is_same_v<decltype(g_32)::index_type, std::uint32_t>);
+    ASSERT_EQ(g_32.n_vertices(), g.n_vertices());
+    ASSERT_EQ(g_32.n_edges(), g.n_edges());
+
+    for (auto v : std::views::iota(0uz, g.n_vertices()))
+    {
+        EXPECT_TRUE(std::ranges::equal(g_32.adjacent_vertices(v), g.adjacent_vertices(v)));
+        EXPECT_TRUE(std::ranges::equal(g_32.adjacent_edges(v), g.adjacent_edges(v)));
+
+        // iterating backwards from the past-the-end iterator
+        auto neighbours = g_32.adjacent_vertices(v);
+        std::vector<std::size_t> reversed(neighbours.begin(), neighbours.end());
+        std::ranges::reverse(reversed);
+        EXPECT_TRUE(std::ranges::equal(neighbours | std::views::reverse, reversed));
+    }
+
+    auto i_7 = g_32.find_vertex(7).value();
+    EXPECT_EQ(g_32.weight(i_7, i_7), 77);
+}
+
+TEST(KGraph, Freeze)
+{
+    std::vector<std::tuple<int, int, int>> edges;
+    for (auto v : std::views::iota(0, 40))
+    {
+        edges.emplace_back(v, (v * 11 + 5) % 40, v);
+        edges.emplace_back(v, (v * 3 + 1) % 40, v + 100);
+    }
+    edges.emplace_back(3, 3, 33); // self-loop
+
+    graphs::KGraph g(edges.begin(), edges.end());
+    graphs::KGraph g_frozen = g;
+    g_frozen.enable_edge_index();
+    EXPECT_TRUE(g_frozen.are_adjacent(0, 1)); // builds the edge index before freezing
+
+    EXPECT_FALSE(g.frozen());
+    g_frozen.freeze();
+    EXPECT_TRUE(g_frozen.frozen());
+
+    ASSERT_EQ(g_frozen.n_vertices(), g.n_vertices());
+    ASSERT_EQ(g_frozen.n_edges(), g.n_edges());
+
+    std::size_t expected_first = 0;
+    for (auto v : std::views::iota(0uz, g.n_vertices()))
+    {
+        EXPECT_TRUE(std::ranges::equal(g_frozen.adjacent_vertices(v), g.adjacent_vertices(v)));
+        EXPECT_TRUE(std::ranges::equal(g_frozen.adjacent_edges(v), g.adjacent_edges(v)));
+
+        // edge nodes incident on v are consecutive
+        for (auto e : std::ranges::subrange{g_frozen.ae_begin(v), g_frozen.ae_end(v)})
+            EXPECT_EQ(e, expected_first++);
+
+        for (auto u : std::views::iota(0uz, g.n_vertices()))
+        {
+            ASSERT_EQ(g_frozen.are_adjacent(v, u), g.are_adjacent(v, u));
+            if (g.are_adjacent(v, u))
+            {
+                EXPECT_EQ(g_frozen.weight(v, u), g.weight(v, u));
+            }
+        }
+    }
+
+    EXPECT_EQ(expected_first, 2 * g.n_edges());
+}
+
+TEST(KGraph, Insert_And_Erase)
+{
+    graphs::KGraph<char, int> g;
+    EXPECT_TRUE(g.empty());
+
+    auto a = g.insert_vertex('a');
+    auto b = g.insert_vertex('b');
+    auto c = g.insert_vertex('c');
+    EXPECT_EQ(g.insert_vertex('a'), a);
+    EXPECT_EQ(g.n_vertices(), 3);
+
+    auto ab = g.insert_edge(a, b, 1);
+    g.insert_edge(b, c, 2);
+    g.insert_edge(c, c, 3); // self-loop
+    EXPECT_EQ(g.insert_edge(a, b, 10), ab); // already adjacent
+    EXPECT_EQ(g.n_edges(), 3);
+    EXPECT_EQ(g.weight(b, a), 1);
+    EXPECT_EQ(g.weight(c, c), 3);
+    EXPECT_TRUE(std::ranges::equal(g.adjacent_vertices(b), std::vector{a, c}));
+    EXPECT_THROW(g.insert_edge(a, 3, 4), std::out_of_range);
+
+    g.erase_edge(ab);
+    EXPECT_EQ(g.n_edges(), 2);
+    EXPECT_FALSE(g.are_adjacent(a, b));
+    EXPECT_TRUE(g.adjacent_vertices(a).empty());
+    EXPECT_TRUE(std::ranges::equal(g.adjacent_vertices(b), std::vector{c}));
+    EXPECT_THROW(g.erase_edge(ab), std::out_of_range);
+
+    g.erase_edge(c, b);
+    g.erase_edge(c, b); // does nothing
+    EXPECT_EQ(g.n_edges(), 1);
+    EXPECT_TRUE(std::ranges::equal(g.adjacent_vertices(c), std::vector{c, c}));
+
+    // edge nodes of erased edges are reused
+    auto ac = g.insert_edge(a, c, 5);
+    auto bc = g.insert_edge(c, b, 6);
+    EXPECT_LT(ac, 6);
+    EXPECT_LT(bc, 6);
+    EXPECT_EQ(g.weight(c, a), 5);
+    EXPECT_EQ(g.weight(b, c), 6);
+    EXPECT_TRUE(std::ranges::equal(g.adjacent_vertices(c), std::vector{c, c, a, b}));
+
+    g.freeze();
+    EXPECT_TRUE(std::ranges::equal(g.adjacent_vertices(c), std::vector{c, c, a, b}));
+
+    auto d = g.insert_vertex('d');
+    g.insert_edge(d, a, 7);
+    EXPECT_FALSE(g.frozen());
+    EXPECT_EQ(g.n_edges(), 4);
+    EXPECT_EQ(g.weight(a, d), 7);
+    EXPECT_TRUE(std::ranges::equal(g.adjacent_vertices(a), std::vector{c, d}));
+
+    g.enable_edge_index();
+    EXPECT_EQ(g.weight(a, c), 5);
+    g.erase_edge(a, c);
+    EXPECT_FALSE(g.are_adjacent(c, a));
+}
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <numeric>
+#include <ranges>
+#include <limits>
+#include <utility>
+
+#include "utils/radix_sort.hpp"
+
+namespace
+{
+
+void check_radix_sort(std::size_t n, std::uint64_t max_key, unsigned n_threads)
+{
+    std::mt19937_64 gen{n};
+    std::uniform_int_distribution<std::uint64_t> key{0, max_key};
+
+    std::vector<std::uint64_t> keys(n);
+    std::ranges::generate(keys, [&]{ return key(gen); });
+
+    std::vector<std::size_t> values(n);
+    std::iota(values.begin(), values.end(), std::size_t{0});
+
+    // sorting pairs (key, index) is equivalent to stable sorting of keys
+    std::vector<std::pair<std::uint64_t, std::size_t>> model;
+    for (auto i : std::views::iota(std::size_t{0}, n))
+        model.emplace_back(keys[i], i);
+    std::ranges::sort(model);
+
+    graphs::radix_sort(keys, values, n_threads);
+
+    ASSERT_EQ(keys.size(), n);
+    for (auto i : std::views::iota(std::size_t{0}, n))
+    {
+        ASSERT_EQ(keys[i], model[i].first);
+        ASSERT_EQ(values[i], model[i].second);
+    }
+}
+
+} // unnamed namespace
+
+TEST(Radix_Sort, Small)
+{
+    check_radix_sort(0, 10, 1);
+    check_radix_sort(1, 10, 1);
+    check_radix_sort(100, 10, 1);
+    check_radix_sort(100, std::numeric_limits<std::uint64_t>::max(), 1);
+}
+
+TEST(Radix_Sort, Equal_Keys)
+{
+    check_radix_sort(1000, 0, 1);
+}
+
+TEST(Radix_Sort, Parallel)
+{
+    check_radix_sort(300'000, 1'000, 4);
+    check_radix_sort(300'000, std::numeric_limits<std::uint64_t>::max(), 4);
+    check_radix_sort(300'000, std::numeric_limits<std::uint64_t>::max(), 0);
+}
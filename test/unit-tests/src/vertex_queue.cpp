@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <ranges>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "utils/vertex_queue.hpp"
+#include "utils/distance.hpp"
+
+namespace
+{
+
+// Pushes keys of n vertices, decreases some of them and checks that vertices are popped in order
+// of their final keys
+template<typename Policy>
+void test_vertex_queue(std::size_t n)
+{
+    using distance_type = graphs::Distance<int>;
+
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<int> key{0, 1'000};
+
+    graphs::Vertex_Queue<Policy, std::size_t, distance_type> Q;
+
+    for (auto _ : std::views::iota(0, 2)) // the second round checks reset()
+    {
+        Q.reset(n);
+        EXPECT_TRUE(Q.empty());
+
+        std::vector<int> keys(n);
+        for (auto i : std::views::iota(0uz, n))
+        {
+            keys[i] = key(gen);
+            Q.push(i, keys[i]);
+        }
+
+        for (auto i : std::views::iota(0uz, n))
+        {
+            if (i % 3 == 0)
+            {
+                keys[i] /= 2;
+                Q.decrease(i, keys[i]);
+            }
+        }
+
+        std::vector<bool> popped(n);
+        int last = 0;
+
+        while (!Q.empty())
+        {
+            auto [i, d] = Q.pop();
+            if (popped[i])
+            {
+                EXPECT_GE(*d, keys[i]); // only stale entries may be popped twice
+                continue;
+            }
+
+            popped[i] = true;
+            EXPECT_EQ(*d, keys[i]);
+            EXPECT_LE(last, *d);
+            last = *d;
+        }
+
+        EXPECT_TRUE(std::ranges::all_of(popped, std::identity{}));
+    }
+}
+
+} // unnamed namespace
+
+TEST(Vertex_Queue, Fibonacci_Heap) { test_vertex_queue<graphs::fibonacci_heap>(1'000); }
+
+TEST(Vertex_Queue, D_Ary_Heap)
+{
+    test_vertex_queue<graphs::d_ary_heap<2>>(1'000);
+    test_vertex_queue<graphs::d_ary_heap<4>>(1'000);
+    test_vertex_queue<graphs::d_ary_heap<8>>(1'000);
+}
+
+TEST(Vertex_Queue, Lazy_Heap) { test_vertex_queue<graphs::lazy_heap>(1'000); }
+
+TEST(Vertex_Queue, Radix_Heap) { test_vertex_queue<graphs::radix_heap>(1'000); }
+
+TEST(Vertex_Queue, Dial_Buckets) { test_vertex_queue<graphs::dial_buckets>(1'000); }
+
+TEST(Vertex_Queue, Default_Queue)
+{
+    static_assert(std::is_same_v<graphs::default_queue<int>, graphs::radix_heap>);
+    static_assert(std::is_same_v<graphs::default_queue<std::uint16_t>, graphs::dial_buckets>);
+    static_assert(std::is_same_v<graphs::default_queue<double>, graphs::d_ary_heap<4>>);
+}
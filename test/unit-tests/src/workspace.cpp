@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+#include <ranges>
+
+#include "graphs/directed_graph.hpp"
+#include "algorithms/bfs.hpp"
+#include "algorithms/dijkstra.hpp"
+#include "algorithms/bellman_ford.hpp"
+#include "utils/workspace.hpp"
+
+TEST(Workspace, Reset)
+{
+    graphs::Workspace<graphs::Distance<int>> ws;
+
+    ws.reset(4);
+    EXPECT_EQ(ws.n_vertices(), 4);
+    EXPECT_TRUE(ws.touched().empty());
+
+    ws.set_distance(2, 5, 1);
+    ws.mark(3);
+    ws.set_distance(3, 7);
+    EXPECT_TRUE(std::ranges::equal(ws.touched(), std::vector{2uz, 3uz}));
+    EXPECT_EQ(ws.predecessor(2), 1);
+    EXPECT_TRUE(ws.marked(3));
+    EXPECT_FALSE(ws.is_touched(0));
+
+    ws.reset(4);
+    EXPECT_TRUE(ws.touched().empty());
+    EXPECT_TRUE(std::ranges::all_of(ws.distances(), [](auto d){ return d.is_inf(); }));
+    EXPECT_TRUE(std::ranges::all_of(ws.predecessors(),
+                                    [](auto p){ return p == decltype(ws)::nil; }));
+    EXPECT_FALSE(ws.marked(3));
+}
+
+/*
+ * Two components: 0 -> 1 -> 2 and 3 -> 4
+ */
+TEST(Workspace, Reuse)
+{
+    graphs::Directed_Graph<int> g{0, 1, 2, 3, 4};
+    g.insert_edges({{0, 1, 1}, {1, 2, 2}, {0, 2, 4}, {3, 4, 3}});
+
+    using G = decltype(g);
+
+    graphs::Dijkstra<G>::workspace_type dijkstra_ws;
+    graphs::BFS<G>::workspace_type bfs_ws;
+    graphs::Bellman_Ford<G>::workspace_type bellman_ford_ws;
+
+    for (auto _ : std::views::iota(0, 2))
+    {
+        for (auto s : std::views::iota(0uz, g.n_vertices()))
+        {
+            const graphs::Dijkstra dijkstra{g, s, dijkstra_ws};
+            const graphs::Dijkstra ref_dijkstra{g, s};
+            EXPECT_TRUE(std::ranges::equal(dijkstra.distances(), ref_dijkstra.distances()));
+            EXPECT_TRUE(std::ranges::equal(dijkstra.predecessors(), ref_dijkstra.predecessors()));
+            EXPECT_EQ(dijkstra_ws.touched().size(), s < 3 ? 3 - s : 5 - s);
+
+            const graphs::BFS bfs{g, s, bfs_ws};
+            const graphs::BFS ref_bfs{g, s};
+            EXPECT_TRUE(std::ranges::equal(bfs.distances(), ref_bfs.distances()));
+            EXPECT_EQ(bfs.path_to(2), ref_bfs.path_to(2));
+
+            const graphs::Bellman_Ford bellman_ford{g, s, bellman_ford_ws};
+            EXPECT_TRUE(std::ranges::equal(bellman_ford.distances(), ref_dijkstra.distances()));
+        }
+    }
+
+    g.insert_edge(2, 0, -5); // creating a negative weight cycle
+
+    const graphs::Bellman_Ford bellman_ford{g, 0, bellman_ford_ws};
+    EXPECT_TRUE(bellman_ford.has_negative_weight_cycles());
+
+    const graphs::Bellman_Ford bellman_ford_2{g, 3, bellman_ford_ws};
+    EXPECT_FALSE(bellman_ford_2.has_negative_weight_cycles());
+    EXPECT_EQ(bellman_ford_2.distance(4), 3);
+    EXPECT_TRUE(bellman_ford_2.distance(0).is_inf());
+}